@@ -0,0 +1,58 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/atomic_quantity.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// every thread adds count / threads values to one shared total
+template <class func_t>
+void contended(std::size_t count, unsigned threads, func_t&& add) {
+    std::vector<std::jthread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&add, count, threads, t] {
+            for (std::size_t i = t; i < count; i += threads) {
+                add(i);
+            }
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    const auto count   = element_count(argc, argv, 10'000'000);
+    const auto threads = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << threads << " threads" << std::endl;
+
+    // the operands alternate between J and kJ
+    const auto operand = [](std::size_t i) { return energy_t<double>{1.0, i % 2 == 0 ? 1.0 : 1000.0}; };
+
+    energy_t<double> locked_total{0.0};
+    std::mutex       mutex;
+    run_benchmark("std::mutex and energy_t<double>::operator+=", count, [&] {
+        contended(count, threads, [&](std::size_t i) {
+            const auto            value = operand(i);
+            const std::lock_guard lock{mutex};
+            locked_total += value;
+        });
+        do_not_optimize(locked_total);
+    });
+
+    atomic_quantity<energy_t<double>> atomic_total;
+    run_benchmark("atomic_quantity<energy_t<double>>::fetch_add", count, [&] {
+        contended(count, threads, [&](std::size_t i) { atomic_total.fetch_add(operand(i), std::memory_order_relaxed); });
+        do_not_optimize(atomic_total);
+    });
+
+    std::atomic<double> raw_total{0.0};
+    run_benchmark("std::atomic<double>::fetch_add on base values", count, [&] {
+        contended(count, threads, [&](std::size_t i) {
+            const auto value = operand(i);
+            raw_total.fetch_add(value.val() * value.mult(), std::memory_order_relaxed);
+        });
+        do_not_optimize(raw_total);
+    });
+}
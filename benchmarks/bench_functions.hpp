@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "unit_system.hpp"
+
+// the number of elements a benchmark works on, can be overwritten with the first command line argument
+inline std::size_t element_count(int argc, char** argv, std::size_t fallback) {
+    if (argc > 1) {
+        return static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10));
+    }
+    return fallback;
+}
+
+// keeps the compiler from optimizing away a result that is never used
+template <class T>
+void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    // the value has to be in memory that the empty asm may read, even if everything else is inlined
+    asm volatile("" : : "r"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// runs setup and func `repeat` times and prints the fastest run of func in ns per element
+template <class setup_t, class func_t>
+double run_benchmark(const std::string& name, std::size_t elements, setup_t&& setup, func_t&& func, int repeat = 5) {
+    auto best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeat; ++i) {
+        setup();
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+        best           = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+    }
+
+    const auto per_element = best / static_cast<double>(std::max<std::size_t>(elements, 1));
+    std::cout << name << ": " << best / 1e6 << " ms, " << per_element << " ns per element" << std::endl;
+    return per_element;
+}
+
+template <class func_t>
+double run_benchmark(const std::string& name, std::size_t elements, func_t&& func, int repeat = 5) {
+    return run_benchmark(name, elements, [] {}, std::forward<func_t>(func), repeat);
+}
@@ -0,0 +1,60 @@
+#include "bench_functions.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// calls that go through several functions of the library, e.g. operator== -> unit_cast -> convert_copy -> constructor.
+// With the C++17 variant these are calls into the shared library, so the time depends on how it is built.
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    std::vector<length> a;
+    std::vector<length> b;
+    a.reserve(count);
+    b.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        a.emplace_back(static_cast<long double>(i % 1000), 1.0);
+        b.emplace_back(static_cast<long double>(i % 1000), 0.001);
+    }
+
+    run_benchmark("operator==", count, [&] {
+        std::size_t equal = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            equal += a[i] == b[i];
+        }
+        do_not_optimize(equal);
+    });
+
+    run_benchmark("operator<", count, [&] {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            less += a[i] < b[i];
+        }
+        do_not_optimize(less);
+    });
+
+    run_benchmark("unit_cast", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += unit_cast(b[i], 1.0).val();
+        }
+        do_not_optimize(sum);
+    });
+
+    run_benchmark("operator+", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (a[i] + b[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+
+    run_benchmark("operator* (length * length)", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (a[i] * b[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# Measures what the C++20 header costs the translation units that include it and writes the result as json.
+#
+# Every synthetic translation unit includes unit_system.hpp, instantiates every unit for float, double and long double,
+# and uses every literal and every cross-unit operator, so the numbers grow with everything the generator adds.
+# The report contains the wall time, the compile time and peak memory of every compiler process,
+# and with clang the most expensive entries of -ftime-trace.
+#
+# usage: compile_cost.py --output compile_cost.json [--tus 8] [--jobs N] [--compiler c++ ...] [-- extra compiler flags]
+# --compiler can be repeated for a launcher and its arguments, e.g. --compiler ccache --compiler g++
+
+import argparse
+import glob
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_DIR = os.path.join(REPO_DIR, 'include')
+UNIT_DIR = os.path.join(INCLUDE_DIR, 'unit_system')
+
+BASE_TYPES = ['float', 'double', 'long double']
+
+
+def units():
+    found = []
+    for path in sorted(glob.glob(os.path.join(UNIT_DIR, '*.hpp'))):
+        match = re.search(r'typedef (\w+)_t<UNIT_SYSTEM_DEFAULT_TYPE> (\w+);', open(path).read())
+        if match:
+            found.append(match.group(1))
+    return found
+
+
+def literals():
+    found = []
+    for path in sorted(glob.glob(os.path.join(UNIT_DIR, '*.hpp'))):
+        found += re.findall(r'operator"" (_\w+)\(long double', open(path).read())
+    return found
+
+
+def operators():
+    found = []
+    pattern = re.compile(r'auto operator([*/])\(const (\w+)_t<base_type>& val, const (\w+)_t<base_type>& other\)')
+    for path in sorted(glob.glob(os.path.join(UNIT_DIR, 'ops', '*.hpp'))):
+        found += pattern.findall(open(path).read())
+    return found
+
+
+def translation_unit(index):
+    lines = ['#include "unit_system.hpp"', '', 'using namespace sakurajin::unit_system;', 'using namespace sakurajin::unit_system::literals;', '']
+
+    # every member of every unit for every base type
+    lines.append('namespace sakurajin { namespace unit_system {')
+    for unit in units():
+        for base in BASE_TYPES:
+            lines.append(f'template class {unit}_t<{base}>;')
+    lines.append('} }')
+    lines.append('')
+
+    lines.append(f'long double literals_{index}() {{')
+    lines.append('    long double sum = 0;')
+    for literal in literals():
+        lines.append(f'    sum += (1.5{literal}).val();')
+    lines.append('    return sum;')
+    lines.append('}')
+    lines.append('')
+
+    for number, base in enumerate(BASE_TYPES):
+        lines.append(f'{base} operators_{index}_{number}({base} x) {{')
+        lines.append(f'    {base} sum = 0;')
+        for op, lhs, rhs in operators():
+            lines.append(f'    sum += ({lhs}_t<{base}>{{x}} {op} {rhs}_t<{base}>{{x}}).val();')
+        for unit in units():
+            lines.append(f'    sum += clamp(unit_cast({unit}_t<{base}>{{x}}, 2), {unit}_t<{base}>{{0}}, {unit}_t<{base}>{{x}}).val();')
+        lines.append('    return sum;')
+        lines.append('}')
+        lines.append('')
+    return '\n'.join(lines)
+
+
+def compile_one(command, cwd):
+    start = time.perf_counter()
+    process = subprocess.Popen(command, cwd=cwd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    # the compiler blocks once the pipe is full, so stderr is read while wait4 collects the resource usage
+    stderr = []
+    reader = threading.Thread(target=lambda: stderr.append(process.stderr.read()))
+    reader.start()
+    _, status, usage = os.wait4(process.pid, 0)
+    duration = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+    reader.join()
+    process.stderr.close()
+    stderr = stderr[0]
+    if process.returncode != 0:
+        sys.exit(f'compilation failed: {" ".join(command)}\n{stderr}')
+    # ru_maxrss is in kilobytes on linux
+    return duration, usage.ru_maxrss
+
+
+def time_trace_hotspots(directory, count=20):
+    totals = {}
+    for path in glob.glob(os.path.join(directory, '*.json')):
+        for event in json.load(open(path)).get('traceEvents', []):
+            if event.get('ph') != 'X' or 'dur' not in event or event.get('name', '').startswith('Total'):
+                continue
+            key = (event['name'], event.get('args', {}).get('detail', ''))
+            totals[key] = totals.get(key, 0) + event['dur']
+    hotspots = sorted(totals.items(), key=lambda item: item[1], reverse=True)[:count]
+    return [{'event': name, 'detail': detail, 'total_ms': duration / 1000} for (name, detail), duration in hotspots]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compile time and memory cost of the unit system header')
+    parser.add_argument('--output', required=True, help='path of the json report')
+    parser.add_argument('--tus', type=int, default=8, help='number of translation units')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1, help='parallel compiler processes')
+    parser.add_argument('--compiler', action='append', help='one word of the compiler command, $CXX if not given')
+    parser.add_argument('--include', action='append', default=[], help='additional include directories')
+    parser.add_argument('flags', nargs='*', help='extra compiler flags, after --')
+    args = parser.parse_args()
+    compiler = args.compiler or shlex.split(os.environ.get('CXX', 'c++'))
+
+    version = subprocess.run([*compiler, '--version'], capture_output=True, text=True).stdout.splitlines()[0]
+    is_clang = 'clang' in version
+
+    directory = tempfile.mkdtemp(prefix='unit_system_compile_cost_')
+    try:
+        sources = []
+        for index in range(args.tus):
+            path = os.path.join(directory, f'tu_{index}.cpp')
+            with open(path, 'w') as f:
+                f.write(translation_unit(index))
+            sources.append(path)
+
+        includes = [f'-I{path}' for path in [INCLUDE_DIR, *args.include]]
+        trace = ['-ftime-trace'] if is_clang else []
+        commands = [[*compiler, '-std=c++20', *includes, *trace, *args.flags, '-c', src, '-o', src + '.o'] for src in sources]
+
+        start = time.perf_counter()
+        with ThreadPoolExecutor(args.jobs) as executor:
+            results = list(executor.map(lambda command: compile_one(command, directory), commands))
+        wall = time.perf_counter() - start
+
+        report = {
+            'compiler': version,
+            'flags': args.flags,
+            'translation_units': args.tus,
+            'units': len(units()),
+            'literals': len(literals()),
+            'cross_unit_operators': len(operators()),
+            'wall_time_s': wall,
+            'compile_time_s': sum(duration for duration, _ in results),
+            'peak_memory_kb': max(memory for _, memory in results),
+            'per_translation_unit': [{'time_s': duration, 'peak_memory_kb': memory} for duration, memory in results],
+            'time_trace_hotspots': time_trace_hotspots(directory) if is_clang else None,
+        }
+    finally:
+        shutil.rmtree(directory)
+
+    with open(args.output, 'w') as f:
+        json.dump(report, f, indent=4)
+
+    print(f'{args.tus} translation units: {report["wall_time_s"]:.2f} s wall, {report["compile_time_s"]:.2f} s compile time, '
+          f'{report["peak_memory_kb"] / 1024:.0f} MB peak memory, report written to {args.output}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+# Measures the compile time of a synthetic project with many translation units that use the unit system,
+# once including unit_system_20.hpp, once with UNIT_SYSTEM_EXTERN_TEMPLATES and once importing the sakurajin.unit_system module.
+# With --headers it instead reports the preprocessed size and parse time of every public header on its own.
+#
+# usage: compile_time.py [--tus 200] [--jobs N] [--compiler g++] [--keep DIR]
+#        compile_time.py --headers [--compiler g++]
+#
+# Only gcc (-fmodules-ts) and clang (--precompile) are supported for the module variant.
+
+import argparse
+import os
+import random
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+from concurrent.futures import ThreadPoolExecutor
+
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_DIR = os.path.join(REPO_DIR, 'include')
+
+# products that exist in the library, (lhs literal, rhs literal)
+PRODUCTS = [
+    ('2_kg', '3_mps2'),
+    ('2_kg', '3_mps'),
+    ('4_m', '5_m'),
+    ('2_s', '3_mps'),
+    ('2_N', '3_m'),
+    ('3_W', '2_s'),
+]
+
+
+def write_sources(directory, count, use_module):
+    rng = random.Random(42)
+    sources = []
+    for i in range(count):
+        lines = []
+        if use_module:
+            lines.append('import sakurajin.unit_system;')
+        else:
+            lines.append('#include "unit_system_20.hpp"')
+        lines.append('using namespace sakurajin::unit_system::literals;')
+        for j in range(5):
+            lhs, rhs = rng.choice(PRODUCTS)
+            lines.append(f'long double tu{i}_f{j}(long double x) {{ auto r = ({lhs} * x) * {rhs}; return r.val() * r.mult(); }}')
+        path = os.path.join(directory, f'tu_{i}.cpp')
+        with open(path, 'w') as f:
+            f.write('\n'.join(lines) + '\n')
+        sources.append(path)
+    return sources
+
+
+def compile_all(commands, jobs, cwd):
+    def run(command):
+        start = time.perf_counter()
+        result = subprocess.run(command, cwd=cwd, capture_output=True, text=True)
+        if result.returncode != 0:
+            sys.exit(f'compilation failed: {" ".join(command)}\n{result.stderr}')
+        return time.perf_counter() - start
+
+    start = time.perf_counter()
+    with ThreadPoolExecutor(jobs) as executor:
+        durations = list(executor.map(run, commands))
+    return time.perf_counter() - start, sum(durations)
+
+
+def compiler_id(compiler):
+    version = subprocess.run([compiler, '--version'], capture_output=True, text=True).stdout
+    return 'clang' if 'clang' in version else 'gcc'
+
+
+def measure_header(compiler, directory, count, jobs, flags=()):
+    sources = write_sources(directory, count, use_module=False)
+    commands = [[compiler, '-std=c++20', *flags, '-I', INCLUDE_DIR, '-c', src, '-o', src + '.o'] for src in sources]
+    return compile_all(commands, jobs, directory)
+
+
+def measure_module(compiler, directory, count, jobs):
+    module_source = os.path.join(INCLUDE_DIR, 'unit_system.cppm')
+    if compiler_id(compiler) == 'gcc':
+        interface = [[compiler, '-std=c++20', '-fmodules-ts', '-I', INCLUDE_DIR, '-x', 'c++', '-c', module_source, '-o', 'module.o']]
+        flags = ['-fmodules-ts']
+    else:
+        pcm = os.path.join(directory, 'sakurajin.unit_system.pcm')
+        interface = [[compiler, '-std=c++20', '-I', INCLUDE_DIR, '--precompile', '-x', 'c++-module', module_source, '-o', pcm]]
+        flags = [f'-fmodule-file=sakurajin.unit_system={pcm}']
+
+    interface_time, _ = compile_all(interface, 1, directory)
+    sources = write_sources(directory, count, use_module=True)
+    commands = [[compiler, '-std=c++20', *flags, '-c', src, '-o', src + '.o'] for src in sources]
+    wall, cpu = compile_all(commands, jobs, directory)
+    return interface_time, wall, cpu
+
+
+def public_headers():
+    headers = ['unit_system_20.hpp']
+    for directory in ['unit_system', os.path.join('unit_system', 'ops')]:
+        for name in sorted(os.listdir(os.path.join(INCLUDE_DIR, directory))):
+            if name.endswith('.hpp'):
+                headers.append(os.path.join(directory, name))
+    return headers
+
+
+def measure_headers(compiler, repeat=3):
+    print(f'{"header":<45} {"preprocessed":>14} {"lines":>8} {"parse time":>12}')
+    for header in public_headers():
+        source = f'#include "{header}"\n'
+        base = [compiler, '-std=c++20', '-I', INCLUDE_DIR, '-x', 'c++']
+
+        preprocessed = subprocess.run(base + ['-E', '-P', '-'], input=source, capture_output=True, text=True)
+        if preprocessed.returncode != 0:
+            sys.exit(f'preprocessing {header} failed\n{preprocessed.stderr}')
+        size = len(preprocessed.stdout.encode())
+        lines = preprocessed.stdout.count('\n')
+
+        best = None
+        for _ in range(repeat):
+            start = time.perf_counter()
+            subprocess.run(base + ['-fsyntax-only', '-'], input=source, capture_output=True, text=True, check=True)
+            duration = time.perf_counter() - start
+            best = duration if best is None else min(best, duration)
+
+        print(f'{header:<45} {size / 1024:>11.1f} kB {lines:>8} {best * 1000:>9.1f} ms')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compile time of many translation units with the header and the module')
+    parser.add_argument('--tus', type=int, default=200, help='number of translation units')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count() or 1, help='parallel compiler processes')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'g++'))
+    parser.add_argument('--keep', help='generate the project in this directory and keep it')
+    parser.add_argument('--headers', action='store_true', help='measure every public header on its own')
+    args = parser.parse_args()
+
+    if args.headers:
+        measure_headers(args.compiler)
+        return
+
+    directory = args.keep or tempfile.mkdtemp(prefix='unit_system_compile_time_')
+    os.makedirs(directory, exist_ok=True)
+    try:
+        header_dir = os.path.join(directory, 'header')
+        module_dir = os.path.join(directory, 'module')
+        os.makedirs(header_dir, exist_ok=True)
+        os.makedirs(module_dir, exist_ok=True)
+
+        print(f'{args.tus} translation units, {args.jobs} jobs, {args.compiler}')
+        wall, cpu = measure_header(args.compiler, header_dir, args.tus, args.jobs)
+        print(f'header: {wall:.2f} s wall, {cpu:.2f} s compiler time, {cpu / args.tus * 1000:.1f} ms per TU')
+
+        wall, cpu = measure_header(args.compiler, header_dir, args.tus, args.jobs, ['-DUNIT_SYSTEM_EXTERN_TEMPLATES'])
+        print(f'header with extern templates: {wall:.2f} s wall, {cpu:.2f} s compiler time, {cpu / args.tus * 1000:.1f} ms per TU')
+
+        interface, wall, cpu = measure_module(args.compiler, module_dir, args.tus, args.jobs)
+        print(f'module: {wall + interface:.2f} s wall ({interface:.2f} s for the interface), '
+              f'{cpu + interface:.2f} s compiler time, {cpu / args.tus * 1000:.1f} ms per TU')
+    finally:
+        if not args.keep:
+            shutil.rmtree(directory)
+
+
+if __name__ == '__main__':
+    main()
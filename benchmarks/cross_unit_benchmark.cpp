@@ -0,0 +1,59 @@
+#include "bench_functions.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// operators between different units, their implementations are spread over several source files of the C++17 variant.
+// Compare a shared, static, unity and lto build to see how much of the library the compiler can inline.
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    std::vector<length>       s;
+    std::vector<time_si>      t;
+    std::vector<mass>         m;
+    std::vector<acceleration> a;
+    s.reserve(count);
+    t.reserve(count);
+    m.reserve(count);
+    a.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<long double>(i % 1000 + 1);
+        s.emplace_back(value, 1.0);
+        t.emplace_back(value, 0.001);
+        m.emplace_back(value, 1.0);
+        a.emplace_back(value, 1.0);
+    }
+
+    run_benchmark("length / time_si -> speed", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (s[i] / t[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+
+    run_benchmark("mass * acceleration -> force", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (m[i] * a[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+
+    run_benchmark("(mass * acceleration) * length -> energy", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (m[i] * a[i] * s[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+
+    run_benchmark("energy / time_si -> power", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += (m[i] * a[i] * s[i] / t[i]).val();
+        }
+        do_not_optimize(sum);
+    });
+}
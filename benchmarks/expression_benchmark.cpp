@@ -0,0 +1,37 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/expression.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// P = m * v * v / t over whole arrays, once with the operators and once as a single expression
+template <class base_type>
+void expression_benchmark(std::size_t count, const std::string& type_name) {
+    const std::vector<mass_t<base_type>>    m(count, mass_t<base_type>{2.0, 1.0});
+    const std::vector<speed_t<base_type>>   v(count, speed_t<base_type>{3.0, 1.0});
+    const std::vector<time_si_t<base_type>> t(count, time_si_t<base_type>{0.5, 0.001});
+    std::vector<power_t<base_type>>         P(count, power_t<base_type>{0.0, 1.0});
+
+    run_benchmark("operator chain with " + type_name, count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            P[i] = m[i] * v[i] * v[i] / t[i];
+        }
+        do_not_optimize(P);
+    });
+
+    run_benchmark("lazy expression with " + type_name, count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            P[i] = lazy(m[i]) * v[i] * v[i] / t[i];
+        }
+        do_not_optimize(P);
+    });
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    expression_benchmark<double>(count, "double");
+    expression_benchmark<long double>(count, "long double");
+}
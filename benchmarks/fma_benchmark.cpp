@@ -0,0 +1,34 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/fma.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// F = m * a + F0 over whole arrays, once with the operators and once with fma
+template <class base_type>
+void fma_benchmark(std::size_t count, const std::string& type_name) {
+    const std::vector<mass_t<base_type>>         m(count, mass_t<base_type>{2.0, 1.0});
+    const std::vector<acceleration_t<base_type>> a(count, acceleration_t<base_type>{3.0, 1.0});
+    std::vector<force_t<base_type>>              F(count, force_t<base_type>{1.0, 1.0});
+
+    run_benchmark("operator* and operator+ with " + type_name, count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            F[i] = m[i] * a[i] + F[i];
+        }
+        do_not_optimize(F);
+    });
+
+    run_benchmark("fma with " + type_name, count, [&] {
+        fma(m, a, F);
+        do_not_optimize(F);
+    });
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    fma_benchmark<double>(count, "double");
+    fma_benchmark<long double>(count, "long double");
+}
@@ -0,0 +1,54 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/latency_histogram.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 50'000'000);
+
+    // request latencies between 10 us and 50 ms, measured with mixed multipliers
+    std::vector<time_si> latencies;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        const auto us = 10.0L + static_cast<long double>((i * 7919) % 50000);
+        latencies.push_back(i % 2 == 0 ? time_si{us, 1e-6} : time_si{us * 1000, 1e-9});
+    }
+
+    latency_histogram histogram;
+    run_benchmark("latency_histogram::record(time_si)", count, [&] { histogram.reset(); }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            histogram.record(latencies[i % latencies.size()]);
+        }
+    });
+    do_not_optimize(histogram.percentile(99));
+
+    std::vector<time_si_t<double>> double_latencies;
+    for (const auto& latency : latencies) {
+        double_latencies.emplace_back(static_cast<double>(latency.val()), static_cast<double>(latency.mult()));
+    }
+    latency_histogram<time_si_t<double>> double_histogram;
+    run_benchmark("latency_histogram::record(time_si_t<double>)", count, [&] { double_histogram.reset(); }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            double_histogram.record(double_latencies[i % double_latencies.size()]);
+        }
+    });
+    do_not_optimize(double_histogram.percentile(99));
+
+    // the lower bound, integer nanoseconds that are already known and a power of two bucket per value
+    std::vector<std::uint64_t> nanoseconds;
+    for (const auto& latency : latencies) {
+        nanoseconds.push_back(static_cast<std::uint64_t>(latency.val() * latency.mult() * 1e9L));
+    }
+    const auto buckets = std::make_unique<std::atomic<std::uint64_t>[]>(64);
+    run_benchmark("integer ns into 64 atomic buckets", count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            buckets[std::bit_width(nanoseconds[i % nanoseconds.size()])].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    do_not_optimize(buckets[0]);
+}
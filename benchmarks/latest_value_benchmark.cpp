@@ -0,0 +1,76 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/latest_value.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// readers threads call read count / readers times while the calling thread keeps storing new values
+template <class read_t, class write_t>
+void readers_and_writer(std::size_t count, unsigned readers, read_t&& read, write_t&& write) {
+    std::atomic<unsigned> running{readers};
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned r = 0; r < readers; ++r) {
+            workers.emplace_back([&] {
+                double sum = 0;
+                for (std::size_t i = 0; i < count / readers; ++i) {
+                    sum += read();
+                }
+                do_not_optimize(sum);
+                running.fetch_sub(1);
+            });
+        }
+        for (std::size_t i = 0; running.load(std::memory_order_relaxed) > 0; ++i) {
+            write(i);
+            // a control loop does not store in a tight loop, this leaves the readers most of the time
+            std::this_thread::yield();
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const auto count   = element_count(argc, argv, 10'000'000);
+    const auto readers = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << readers << " reader threads and one writer" << std::endl;
+
+    const auto value = [](std::size_t i) { return speed_t<double>{static_cast<double>(i % 100), 1.0 / 3.6}; };
+
+    speed_t<double> locked{0.0};
+    std::mutex      mutex;
+    run_benchmark("std::mutex and speed_t<double>", count, [&] {
+        readers_and_writer(
+            count,
+            readers,
+            [&] {
+                const std::lock_guard lock{mutex};
+                return locked.val();
+            },
+            [&](std::size_t i) {
+                const std::lock_guard lock{mutex};
+                locked = value(i);
+            });
+    });
+
+    latest_value<speed_t<double>> cell;
+    run_benchmark("latest_value<speed_t<double>>", count, [&] {
+        readers_and_writer(
+            count,
+            readers,
+            [&] { return cell.load().val(); },
+            [&](std::size_t i) { cell.store(value(i)); });
+    });
+
+    latest_value<speed> long_double_cell;
+    run_benchmark("latest_value<speed_t<long double>>", count, [&] {
+        readers_and_writer(
+            count,
+            readers,
+            [&] { return static_cast<double>(long_double_cell.load().val()); },
+            [&](std::size_t i) { long_double_cell.store(speed{static_cast<long double>(i % 100), 1.0 / 3.6}); });
+    });
+}
@@ -0,0 +1,63 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/lookup_table.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// interpolates a spring curve with `samples` points for `count` random lengths
+void lookup_benchmark(std::size_t count, std::size_t samples, bool uniform) {
+    std::mt19937                           gen{1234};
+    std::uniform_real_distribution<double> key_dist{0.0, 1.0};
+
+    std::vector<length_t<double>> x;
+    std::vector<force_t<double>>  y;
+    for (std::size_t i = 0; i < samples; ++i) {
+        const auto key = uniform ? static_cast<double>(i) : static_cast<double>(i) + 0.5 * key_dist(gen);
+        x.emplace_back(key, 0.001);
+        y.emplace_back(key * key, 1.0);
+    }
+
+    std::vector<length_t<double>> inputs;
+    inputs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        inputs.emplace_back(key_dist(gen) * static_cast<double>(samples), 0.001);
+    }
+    std::vector<force_t<double>> outputs(count);
+
+    const auto name = std::string{uniform ? "uniform" : "non uniform"} + " table with " + std::to_string(samples) + " samples";
+
+    // the straight forward way: binary search with the unit comparison operators
+    run_benchmark(name + ", std::upper_bound", count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto it = std::upper_bound(x.begin() + 1, x.end() - 1, inputs[i]);
+            const auto j  = static_cast<std::size_t>(it - x.begin()) - 1;
+            const auto t  = (inputs[i] - x[j]) / (x[j + 1] - x[j]);
+            outputs[i]    = y[j] + (y[j + 1] - y[j]) * t;
+        }
+        do_not_optimize(outputs);
+    });
+
+    const lookup_table<length_t<double>, force_t<double>> linear{x, y};
+    run_benchmark(name + ", linear lookup_table", count, [&] {
+        linear.evaluate(inputs, outputs);
+        do_not_optimize(outputs);
+    });
+
+    const lookup_table<length_t<double>, force_t<double>> cubic{x, y, interpolation::cubic};
+    run_benchmark(name + ", cubic lookup_table", count, [&] {
+        cubic.evaluate(inputs, outputs);
+        do_not_optimize(outputs);
+    });
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    lookup_benchmark(count, 64, true);
+    lookup_benchmark(count, 64, false);
+    lookup_benchmark(count, 65536, false);
+}
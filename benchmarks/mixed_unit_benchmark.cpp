@@ -0,0 +1,43 @@
+#include "bench_functions.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// a loop that touches all units, so the code of every unit has to be in the instruction cache at the same time
+template <class unit_t>
+long double touch(const unit_t& a, const unit_t& b) {
+    const auto sum = a + b;
+    return sum.val() + (a < b) + (a == b) + unit_cast(b, 2.0).val();
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 1'000'000);
+
+    std::vector<long double> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<long double>(i % 1000 + 1);
+    }
+
+    run_benchmark("all 14 units per element", count, [&] {
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto v = values[i];
+            sum += touch(time_si{v, 1.0}, time_si{v, 60.0});
+            sum += touch(length{v, 1.0}, length{v, 1000.0});
+            sum += touch(mass{v, 1.0}, mass{v, 0.001});
+            sum += touch(temperature{v, 1.0, 0.0}, temperature{v, 1.0, 273.15});
+            sum += touch(amount{v, 1.0}, amount{v, 2.0});
+            sum += touch(electric_current{v, 1.0}, electric_current{v, 0.001});
+            sum += touch(luminous_intensity{v, 1.0}, luminous_intensity{v, 2.0});
+            sum += touch(energy{v, 1.0}, energy{v, 1000.0});
+            sum += touch(power{v, 1.0}, power{v, 1000.0});
+            sum += touch(speed{v, 1.0}, speed{v, 3.6});
+            sum += touch(acceleration{v, 1.0}, acceleration{v, 2.0});
+            sum += touch(area{v, 1.0}, area{v, 1e6});
+            sum += touch(force{v, 1.0}, force{v, 1000.0});
+            sum += touch(momentum{v, 1.0}, momentum{v, 2.0});
+        }
+        do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,58 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/parallel.hpp"
+#include "unit_system/quantity_vector.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+int main(int argc, char** argv) {
+    // 1e9 elements need about 100 GB for the unit arrays, pass the count as the first argument on machines that have it
+    const auto count   = element_count(argc, argv, 4'000'000);
+    const auto threads = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    std::vector<force_t<double>>  forces;
+    std::vector<length_t<double>> lengths;
+    forces.reserve(count);
+    lengths.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        forces.emplace_back(static_cast<double>(i % 13), i % 2 == 0 ? 1.0 : 1000.0);
+        lengths.emplace_back(static_cast<double>(i % 7), i % 3 == 0 ? 1.0 : 0.001);
+    }
+    std::vector<energy_t<double>> energies(count);
+
+    const quantity_vector<force_t<double>>  F{forces};
+    const quantity_vector<length_t<double>> s{lengths};
+    quantity_vector<energy_t<double>>       E(count);
+
+    // the calling thread is one of the threads, so a pool with t - 1 workers uses t threads
+    for (unsigned t = 1; t <= threads; ++t) {
+        thread_pool           pool{t - 1};
+        const parallel_policy policy{&pool};
+        const auto            suffix = " with " + std::to_string(t) + " threads";
+
+        run_benchmark("multiply force * length -> energy" + suffix, count, [&] {
+            multiply(policy, forces, lengths, energies);
+            do_not_optimize(energies);
+        });
+        run_benchmark("convert length to mm" + suffix, count, [&] {
+            convert(policy, lengths, lengths, length_t<double>{0, 0.001});
+            do_not_optimize(lengths);
+        });
+        run_benchmark("reduce energy" + suffix, count, [&] {
+            const auto total = reduce(policy, energies);
+            do_not_optimize(total);
+        });
+        run_benchmark("clamp energy" + suffix, count, [&] {
+            clamp(policy, energies, energy_t<double>{1.0}, energy_t<double>{10.0, 1000.0});
+            do_not_optimize(energies);
+        });
+        run_benchmark("quantity_vector E = F * s" + suffix, count, [&] {
+            E.assign(F * s, policy);
+            do_not_optimize(E);
+        });
+    }
+}
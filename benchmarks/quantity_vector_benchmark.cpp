@@ -0,0 +1,45 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/quantity_vector.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// E = 0.5 * m * v * v over whole columns, once with an element loop over the operators
+// and once as a fused expression over quantity_vectors
+template <class base_type>
+void quantity_vector_benchmark(std::size_t count, const std::string& type_name) {
+    const std::vector<mass_t<base_type>>  m(count, mass_t<base_type>{2.0, 1.0});
+    const std::vector<speed_t<base_type>> v(count, speed_t<base_type>{3.0, 1.0});
+    std::vector<energy_t<base_type>>      E(count, energy_t<base_type>{0.0, 1.0});
+
+    run_benchmark("element loop with " + type_name, count, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            E[i] = 0.5 * m[i] * v[i] * v[i];
+        }
+        do_not_optimize(E);
+    });
+
+    const quantity_vector<mass_t<base_type>>  m_vec{m};
+    const quantity_vector<speed_t<base_type>> v_vec{v};
+    quantity_vector<energy_t<base_type>>      E_vec(count, energy_t<base_type>{0.0, 1.0});
+
+    run_benchmark("fused expression with " + type_name, count, [&] {
+        E_vec = 0.5 * m_vec * v_vec * v_vec;
+        do_not_optimize(E_vec);
+    });
+
+    const auto threads = default_thread_pool().worker_count() + 1;
+    run_benchmark("fused expression on " + std::to_string(threads) + " threads with " + type_name, count, [&] {
+        E_vec.assign(0.5 * m_vec * v_vec * v_vec, par);
+        do_not_optimize(E_vec);
+    });
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    quantity_vector_benchmark<double>(count, "double");
+    quantity_vector_benchmark<long double>(count, "long double");
+}
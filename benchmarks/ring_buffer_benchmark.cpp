@@ -0,0 +1,86 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/ring_buffer.hpp"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+constexpr std::size_t batch_size = 256;
+
+// producers push count samples in batches of batch_size while the calling thread pops them
+template <class queue_t>
+void transfer(queue_t& queue, std::size_t count, unsigned producers, const std::vector<electric_current_t<double>>& samples) {
+    std::vector<std::jthread> workers;
+    for (unsigned p = 0; p < producers; ++p) {
+        workers.emplace_back([&, p] {
+            const auto per_producer = count / producers;
+            for (std::size_t i = 0; i < per_producer;) {
+                const auto n      = std::min(batch_size, per_producer - i);
+                const auto pushed = queue.push(std::span{samples}.subspan((i + p) % (samples.size() - batch_size), n));
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                i += pushed;
+            }
+        });
+    }
+
+    std::array<electric_current_t<double>, batch_size> out;
+    double                                             sum      = 0;
+    std::size_t                                        received = 0;
+    while (received < count / producers * producers) {
+        const auto n = queue.pop(out);
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += out[i].val();
+        }
+        received += n;
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    do_not_optimize(sum);
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 20'000'000);
+    std::cout << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+    // samples in A with mixed multipliers, the queues store mA
+    std::vector<electric_current_t<double>> samples;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        samples.emplace_back(static_cast<double>(i % 100), i % 2 == 0 ? 1.0 : 0.001);
+    }
+    const electric_current_t<double> milli{0, 0.001};
+
+    spsc_queue<electric_current_t<double>> spsc{4096, milli};
+    run_benchmark("spsc_queue, batches of 256", count, [&] { transfer(spsc, count, 1, samples); });
+
+    mpsc_queue<electric_current_t<double>> mpsc{4096, milli};
+    run_benchmark("mpsc_queue with 1 producer, batches of 256", count, [&] { transfer(mpsc, count, 1, samples); });
+    run_benchmark("mpsc_queue with 2 producers, batches of 256", count, [&] { transfer(mpsc, count, 2, samples); });
+
+    // one sample per push and pop
+    spsc_queue<electric_current_t<double>> single{4096, milli};
+    run_benchmark("spsc_queue, single push and pop", count, [&] {
+        std::jthread producer{[&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                while (!single.push(samples[i % samples.size()])) {
+                    std::this_thread::yield();
+                }
+            }
+        }};
+        double sum = 0;
+        for (std::size_t received = 0; received < count;) {
+            if (const auto value = single.pop()) {
+                sum += value->val();
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        do_not_optimize(sum);
+    });
+}
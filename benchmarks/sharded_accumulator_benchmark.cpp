@@ -0,0 +1,70 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/atomic_quantity.hpp"
+#include "unit_system/sharded_accumulator.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// every thread adds count / threads values, add gets the index of the thread
+template <class func_t>
+void per_thread(std::size_t count, unsigned threads, func_t&& add) {
+    std::vector<std::jthread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&add, count, threads, t] {
+            for (std::size_t i = t; i < count; i += threads) {
+                add(t, i);
+            }
+        });
+    }
+}
+
+int main(int argc, char** argv) {
+    const auto count   = element_count(argc, argv, 10'000'000);
+    const auto threads = std::max(2u, std::thread::hardware_concurrency());
+    std::cout << threads << " threads" << std::endl;
+
+    // the operands alternate between J and kJ
+    const auto operand = [](std::size_t i) { return energy_t<double>{1.0, i % 2 == 0 ? 1.0 : 1000.0}; };
+
+    atomic_quantity<energy_t<double>> atomic_total;
+    run_benchmark("atomic_quantity<energy_t<double>>::fetch_add", count, [&] {
+        per_thread(count, threads, [&](unsigned, std::size_t i) { atomic_total.fetch_add(operand(i), std::memory_order_relaxed); });
+        do_not_optimize(atomic_total);
+    });
+
+    sharded_accumulator<energy_t<double>> sharded_total{threads};
+    run_benchmark("sharded_accumulator<energy_t<double>>::add", count, [&] {
+        per_thread(count, threads, [&](unsigned t, std::size_t i) { sharded_total.add(t, operand(i)); });
+        const auto total = sharded_total.load();
+        do_not_optimize(total);
+    });
+
+    // the same without an index, every thread adds to the shard of its thread number
+    sharded_accumulator<energy_t<double>> thread_total{threads};
+    run_benchmark("sharded_accumulator<energy_t<double>>::add, shard of the thread", count, [&] {
+        per_thread(count, threads, [&](unsigned, std::size_t i) { thread_total.add(operand(i)); });
+        const auto total = thread_total.load();
+        do_not_optimize(total);
+    });
+
+    sharded_accumulator<energy_t<double>, summation::compensated> compensated_total{threads};
+    run_benchmark("sharded_accumulator<energy_t<double>, summation::compensated>::add", count, [&] {
+        per_thread(count, threads, [&](unsigned t, std::size_t i) { compensated_total.add(t, operand(i)); });
+        const auto total = compensated_total.load();
+        do_not_optimize(total);
+    });
+
+    // one unpadded double per thread, the shards share a cache line
+    std::vector<double> raw_totals(threads);
+    run_benchmark("unpadded double per thread", count, [&] {
+        per_thread(count, threads, [&](unsigned t, std::size_t i) {
+            const auto value = operand(i);
+            raw_totals[t] += value.val() * value.mult();
+            do_not_optimize(raw_totals[t]);
+        });
+        do_not_optimize(raw_totals);
+    });
+}
@@ -0,0 +1,114 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/shm_channel.hpp"
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// the reader runs in a child process and sums up count values, returns when the child is done
+template <class read_t, class write_t>
+void across_processes(read_t&& read, write_t&& write) {
+    const auto child = ::fork();
+    if (child == 0) {
+        read();
+        ::_exit(0);
+    }
+    write();
+    int status = 0;
+    ::waitpid(child, &status, 0);
+}
+
+int main(int argc, char** argv) {
+    const auto  count      = element_count(argc, argv, 20'000'000);
+    const auto  name       = "/unit_system_benchmark_" + std::to_string(::getpid());
+    std::size_t batch_size = 1024;
+
+    // samples in A with mixed multipliers, the channel stores mA
+    std::vector<electric_current_t<double>> samples;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        samples.emplace_back(static_cast<double>(i % 100), i % 2 == 0 ? 1.0 : 0.001);
+    }
+
+    run_benchmark("shm channel, units in batches of 1024", count, [&] {
+        shm_writer<electric_current_t<double>> writer{name, 1 << 16, electric_current_t<double>{0, 0.001}};
+        across_processes(
+            [&] {
+                shm_reader<electric_current_t<double>> reader{name};
+                double                                 sum = 0;
+                for (std::size_t received = 0; received < count;) {
+                    // the values are summed up in place without copying them
+                    const auto available = reader.peek();
+                    for (const auto value : available) {
+                        sum += value;
+                    }
+                    reader.consume(available.size());
+                    received += available.size();
+                    if (available.empty()) {
+                        std::this_thread::yield();
+                    }
+                }
+                do_not_optimize(sum);
+            },
+            [&] {
+                for (std::size_t written = 0; written < count;) {
+                    const auto n      = std::min(batch_size, count - written);
+                    const auto batch  = std::span{samples}.subspan(written % (samples.size() - batch_size), n);
+                    const auto pushed = writer.write(batch);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    written += pushed;
+                }
+            });
+    });
+
+    // what the daemon does today, the values are converted to mA and sent over a unix socket
+    run_benchmark("unix socket, doubles in batches of 1024", count, [&] {
+        int fds[2];
+        ::socketpair(AF_UNIX, SOCK_STREAM, 0, fds);
+        across_processes(
+            [&] {
+                ::close(fds[0]);
+                std::vector<double> buffer(batch_size);
+                double              sum = 0;
+                for (std::size_t received = 0; received < count * sizeof(double);) {
+                    const auto bytes = ::read(fds[1], buffer.data(), buffer.size() * sizeof(double));
+                    if (bytes <= 0) {
+                        break;
+                    }
+                    for (std::size_t i = 0; i < static_cast<std::size_t>(bytes) / sizeof(double); ++i) {
+                        sum += buffer[i];
+                    }
+                    received += static_cast<std::size_t>(bytes);
+                }
+                do_not_optimize(sum);
+            },
+            [&] {
+                std::vector<double> buffer(batch_size);
+                for (std::size_t written = 0; written < count;) {
+                    const auto n = std::min(batch_size, count - written);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        buffer[i] = samples[(written + i) % samples.size()].convert_copy(0.001, 0).val();
+                    }
+                    const auto* bytes = reinterpret_cast<const char*>(buffer.data());
+                    for (std::size_t sent = 0; sent < n * sizeof(double);) {
+                        const auto result = ::write(fds[0], bytes + sent, n * sizeof(double) - sent);
+                        if (result <= 0) {
+                            return;
+                        }
+                        sent += static_cast<std::size_t>(result);
+                    }
+                    written += n;
+                }
+            });
+        ::close(fds[0]);
+        ::close(fds[1]);
+    });
+}
@@ -0,0 +1,41 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// sorts lengths with mixed km, m and mm multipliers
+template <class base_type>
+void sort_benchmark(std::size_t count, const std::string& type_name) {
+    std::mt19937                           gen{1234};
+    std::uniform_real_distribution<double> value_dist{0.0, 1000.0};
+    std::uniform_int_distribution<int>     unit_dist{0, 2};
+    const std::array<double, 3>            multipliers{1000.0, 1.0, 0.001};
+
+    std::vector<length_t<base_type>> input;
+    input.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        input.emplace_back(value_dist(gen), multipliers[unit_dist(gen)]);
+    }
+
+    std::vector<length_t<base_type>> values;
+    const auto                       reset = [&] { values = input; };
+
+    run_benchmark("std::sort<length_t<" + type_name + ">>", count, reset, [&] { std::sort(values.begin(), values.end()); });
+    run_benchmark("unit_system::sort<length_t<" + type_name + ">>", count, reset, [&] { sakurajin::unit_system::sort(values); });
+    run_benchmark("unit_system::stable_sort<length_t<" + type_name + ">>", count, reset, [&] { stable_sort(values); });
+    run_benchmark("unit_system::nth_element<length_t<" + type_name + ">>", count, reset, [&] { nth_element(values, count / 2); });
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    sort_benchmark<double>(count, "double");
+    sort_benchmark<float>(count, "float");
+    sort_benchmark<long double>(count, "long double");
+}
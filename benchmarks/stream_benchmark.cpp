@@ -0,0 +1,66 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/stream.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+// one resume per value
+quantity_stream<power> single_values(const std::vector<power>& values) {
+    for (const auto& value : values) {
+        co_yield value;
+    }
+}
+
+template <class stream_t>
+long double consume(stream_t&& stream) {
+    long double sum = 0;
+    for (const auto batch : stream) {
+        for (const auto& value : batch) {
+            sum += value.val();
+        }
+    }
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 10'000'000);
+
+    std::vector<power> samples;
+    samples.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        samples.emplace_back(static_cast<long double>(i % 1000), i % 2 == 0 ? 1.0 : 1000.0);
+    }
+    const auto keep = [](const power& p) { return p.val() >= 100; };
+
+    run_benchmark("loop: convert, filter and window sum", count, [&] {
+        long double sum    = 0;
+        long double window = 0;
+        std::size_t filled = 0;
+        for (const auto& sample : samples) {
+            const auto kW = sample.convert_copy(1000.0, 0.0);
+            if (keep(kW)) {
+                window += kW.val() * kW.mult();
+                if (++filled == 64) {
+                    sum += window;
+                    window = 0;
+                    filled = 0;
+                }
+            }
+        }
+        do_not_optimize(sum);
+    });
+
+    for (const std::size_t batch_size : {std::size_t{1}, std::size_t{16}, std::size_t{256}, std::size_t{4096}}) {
+        run_benchmark("stream in batches of " + std::to_string(batch_size), count, [&] {
+            const auto sum = consume(stream_batches(samples, batch_size) | convert_to(1000.0) | where(keep) | window_sum(64));
+            do_not_optimize(sum);
+        });
+    }
+
+    run_benchmark("stream of single values", count, [&] {
+        const auto sum = consume(single_values(samples) | convert_to(1000.0) | where(keep) | window_sum(64));
+        do_not_optimize(sum);
+    });
+}
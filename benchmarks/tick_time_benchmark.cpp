@@ -0,0 +1,81 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/tick_time.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 100'000'000);
+
+    // request durations between 1 and 1000 ns
+    std::vector<std::int64_t> nanoseconds;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        nanoseconds.push_back(1 + static_cast<std::int64_t>((i * 7919) % 1000));
+    }
+    std::vector<time_si>                  units;
+    std::vector<tick_ns>                  ticks;
+    std::vector<std::chrono::nanoseconds> durations;
+    for (const auto ns : nanoseconds) {
+        units.emplace_back(static_cast<long double>(ns), 1e-9);
+        ticks.emplace_back(ns);
+        durations.emplace_back(ns);
+    }
+
+    // the exact sum, to print how far the floating point sum drifts
+    std::int64_t exact = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        exact += nanoseconds[i % nanoseconds.size()];
+    }
+
+    time_si unit_sum{0, 1e-9};
+    run_benchmark("time_si += time_si", count, [&] { unit_sum = time_si{0, 1e-9}; }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            unit_sum += units[i % units.size()];
+        }
+    });
+    std::cout << "  error of the sum: " << static_cast<double>(unit_sum.val() - static_cast<long double>(exact)) << " ns" << std::endl;
+
+    // the floating point sum the way most code uses it, in double seconds
+    double double_sum = 0;
+    run_benchmark("double seconds +=", count, [&] { double_sum = 0; }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            double_sum += static_cast<double>(nanoseconds[i % nanoseconds.size()]) * 1e-9;
+        }
+    });
+    std::cout << "  error of the sum: " << double_sum * 1e9 - static_cast<double>(exact) << " ns" << std::endl;
+
+    tick_ns tick_sum;
+    run_benchmark("tick_ns += tick_ns", count, [&] { tick_sum = tick_ns{}; }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            tick_sum += ticks[i % ticks.size()];
+        }
+    });
+    std::cout << "  error of the sum: " << tick_sum.count() - exact << " ns" << std::endl;
+
+    std::chrono::nanoseconds chrono_sum{0};
+    run_benchmark("std::chrono::nanoseconds +=", count, [&] { chrono_sum = {}; }, [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            chrono_sum += durations[i % durations.size()];
+        }
+    });
+    do_not_optimize(chrono_sum);
+
+    // converting std::chrono durations to units
+    long double converted = 0;
+    run_benchmark("unit_cast(std::chrono::nanoseconds)", count / 10, [&] { converted = 0; }, [&] {
+        for (std::size_t i = 0; i < count / 10; ++i) {
+            converted += unit_cast(durations[i % durations.size()]).val();
+        }
+    });
+    do_not_optimize(converted);
+    run_benchmark("unit_cast(tick_ns)", count / 10, [&] { converted = 0; }, [&] {
+        for (std::size_t i = 0; i < count / 10; ++i) {
+            converted += unit_cast(tick_ns{durations[i % durations.size()]}).val();
+        }
+    });
+    do_not_optimize(converted);
+}
@@ -0,0 +1,64 @@
+#include "bench_functions.hpp"
+
+#include "unit_system/unit_registry.hpp"
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+int main(int argc, char** argv) {
+    const auto count = element_count(argc, argv, 20'000'000);
+
+    // the symbols an ingest thread sees, every symbol of the library in turn
+    std::vector<std::string_view> symbols;
+    for (const auto& unit : builtin_units) {
+        symbols.push_back(unit.symbol);
+    }
+
+    // a configuration reload adds a batch of units every few ms while the symbols are looked up
+    const auto with_reloads = [&](auto&& lookup, auto&& reload) {
+        std::atomic<bool> done{false};
+        std::jthread      config{[&] {
+            for (int i = 0; !done.load(std::memory_order_relaxed); ++i) {
+                reload(i);
+                std::this_thread::sleep_for(std::chrono::milliseconds{5});
+            }
+        }};
+        long double sum = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            sum += lookup(symbols[i % symbols.size()]);
+        }
+        done = true;
+        do_not_optimize(sum);
+    };
+
+    unit_registry registry;
+    run_benchmark("unit_registry::lookup", count, [&] {
+        with_reloads([&](std::string_view symbol) { return registry.lookup(symbol)->mult; },
+                     [&](int i) { registry.add("reload_" + std::to_string(i), unit_definition{dimension_of<speed>, 1.0, 0.0}); });
+    });
+
+    // what a shared configuration usually looks like, a map behind a reader writer lock
+    std::map<std::string, unit_definition, std::less<>> map;
+    std::shared_mutex                                   mutex;
+    for (const auto& unit : builtin_units) {
+        map.emplace(unit.symbol, unit.definition);
+    }
+    run_benchmark("std::map behind std::shared_mutex", count, [&] {
+        with_reloads(
+            [&](std::string_view symbol) {
+                const std::shared_lock lock{mutex};
+                return map.find(symbol)->second.mult;
+            },
+            [&](int i) {
+                const std::unique_lock lock{mutex};
+                map.emplace("reload_" + std::to_string(i), unit_definition{dimension_of<speed>, 1.0, 0.0});
+            });
+    });
+}
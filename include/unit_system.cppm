@@ -0,0 +1,41 @@
+module;
+
+// the standard headers are included in the global module fragment so they are not attached to the module.
+// This has to list every standard header unit_system_20.hpp and the unit headers include, otherwise the include guards
+// of the header skip them here and they are declared again inside the module.
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <iosfwd>
+#include <iostream>
+#include <ostream>
+#include <ratio>
+
+export module sakurajin.unit_system;
+
+// the module exports everything unit_system_20.hpp declares, the header stays the interface for non module users
+export {
+#include "unit_system_20.hpp"
+}
+
+// the literal operators are inline functions of the module that are not used in it,
+// without these instantiations gcc 12 does not emit the constructors they call for importers
+namespace sakurajin {
+    namespace unit_system {
+        template time_si_t<UNIT_SYSTEM_DEFAULT_TYPE>::time_si_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template length_t<UNIT_SYSTEM_DEFAULT_TYPE>::length_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template mass_t<UNIT_SYSTEM_DEFAULT_TYPE>::mass_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template temperature_t<UNIT_SYSTEM_DEFAULT_TYPE>::temperature_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template amount_t<UNIT_SYSTEM_DEFAULT_TYPE>::amount_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template electric_current_t<UNIT_SYSTEM_DEFAULT_TYPE>::electric_current_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template luminous_intensity_t<UNIT_SYSTEM_DEFAULT_TYPE>::luminous_intensity_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template energy_t<UNIT_SYSTEM_DEFAULT_TYPE>::energy_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template power_t<UNIT_SYSTEM_DEFAULT_TYPE>::power_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template speed_t<UNIT_SYSTEM_DEFAULT_TYPE>::speed_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template acceleration_t<UNIT_SYSTEM_DEFAULT_TYPE>::acceleration_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template area_t<UNIT_SYSTEM_DEFAULT_TYPE>::area_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template force_t<UNIT_SYSTEM_DEFAULT_TYPE>::force_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+        template momentum_t<UNIT_SYSTEM_DEFAULT_TYPE>::momentum_t(UNIT_SYSTEM_DEFAULT_TYPE, double, double);
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <atomic>
+#include <concepts>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // units whose base type fits into a lock-free atomic, float and double on all common targets
+        template <class unit_t>
+        concept lock_free_unit = unit_type<unit_t> && std::atomic<unit_base_t<unit_t>>::is_always_lock_free;
+
+        // A unit that several threads can update without a mutex, e.g. the total energy delivered by all workers.
+        //
+        // The value is kept in base units (multiplier 1, offset 0) in a single std::atomic of the base type,
+        // so fetch_add and fetch_sub accept units with any multiplier and only convert the operand before the atomic update.
+        // Both are a compare exchange loop on the base value, which is what std::atomic<double>::fetch_add compiles to as well.
+        // long double units are not lock-free on most targets, use e.g. atomic_quantity<energy_t<double>> for them.
+        template <lock_free_unit unit_t>
+        class atomic_quantity {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+            static constexpr bool is_always_lock_free = std::atomic<base_type>::is_always_lock_free;
+
+          private:
+            std::atomic<base_type> value{0};
+
+            static base_type to_base(const unit_t& unit) noexcept { return base_value(unit); }
+            static unit_t    from_base(base_type base) noexcept { return unit_t{base, 1, 0}; }
+
+          public:
+            atomic_quantity() noexcept = default;
+
+            explicit atomic_quantity(const unit_t& initial) noexcept
+                : value{to_base(initial)} {}
+
+            atomic_quantity(const atomic_quantity&)            = delete;
+            atomic_quantity& operator=(const atomic_quantity&) = delete;
+
+            [[nodiscard]]
+            bool is_lock_free() const noexcept {
+                return value.is_lock_free();
+            }
+
+            // the current value in base units
+            [[nodiscard]]
+            unit_t load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return from_base(value.load(order));
+            }
+
+            void store(const unit_t& unit, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                value.store(to_base(unit), order);
+            }
+
+            // stores unit and returns the previous value in base units
+            unit_t exchange(const unit_t& unit, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return from_base(value.exchange(to_base(unit), order));
+            }
+
+            // adds unit and returns the previous value in base units
+            unit_t fetch_add(const unit_t& unit, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                const auto delta    = to_base(unit);
+                auto       expected = value.load(std::memory_order_relaxed);
+                while (!value.compare_exchange_weak(expected, expected + delta, order, std::memory_order_relaxed)) {
+                }
+                return from_base(expected);
+            }
+
+            // subtracts unit and returns the previous value in base units
+            unit_t fetch_sub(const unit_t& unit, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                const auto delta    = to_base(unit);
+                auto       expected = value.load(std::memory_order_relaxed);
+                while (!value.compare_exchange_weak(expected, expected - delta, order, std::memory_order_relaxed)) {
+                }
+                return from_base(expected);
+            }
+
+            void operator+=(const unit_t& unit) noexcept { fetch_add(unit); }
+            void operator-=(const unit_t& unit) noexcept { fetch_sub(unit); }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
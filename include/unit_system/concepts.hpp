@@ -0,0 +1,47 @@
+#pragma once
+
+#include "unit_system_20.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // any of the generated unit classes, e.g. length_t<double> or energy_t<long double>
+        template <class unit_t>
+        concept unit_type = requires(const unit_t& unit) {
+            { unit.val() } -> std::floating_point;
+            { unit.mult() } -> std::floating_point;
+            { unit.off() } -> std::floating_point;
+            { unit.convert_like(unit) } -> std::same_as<unit_t>;
+        } && std::constructible_from<unit_t,
+                                     decltype(std::declval<const unit_t&>().val()),
+                                     decltype(std::declval<const unit_t&>().val()),
+                                     decltype(std::declval<const unit_t&>().val())>;
+
+        // the floating point type a unit stores its value, multiplier and offset in
+        template <unit_type unit_t>
+        using unit_base_t = std::remove_cvref_t<decltype(std::declval<const unit_t&>().val())>;
+
+        // the value of a unit in base units (multiplier 1, offset 0), the same value as convert_copy(1, 0).val()
+        template <unit_type unit_t>
+        unit_base_t<unit_t> base_value(const unit_t& unit) {
+            return unit.val() * unit.mult() + unit.off();
+        }
+
+        // the alignment that keeps data written by different threads on different cache lines,
+        // 64 bytes on x86-64 and most arm cores, std::hardware_destructive_interference_size is not stable across compiler flags
+        inline constexpr std::size_t cache_line_size = 64;
+
+        // contiguous storage of units like std::vector<length> or std::span<const speed>
+        template <class range_t>
+        concept unit_range = std::ranges::contiguous_range<range_t> && std::ranges::sized_range<range_t> &&
+                             unit_type<std::ranges::range_value_t<range_t>>;
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,20 @@
+#pragma once
+
+
+#if __cplusplus < 202002L
+    #error "C++ 20 support is required"
+#endif
+
+
+#ifndef UNIT_SYSTEM_DEFAULT_TYPE
+    #define UNIT_SYSTEM_DEFAULT_TYPE long double
+#endif
+
+// only the declarations of the streams, operator<< of the units needs <ostream> where it is used
+#include <concepts>
+#include <iosfwd>
+#include <ratio>
+
+#ifndef UNIT_SYSTEM_EXPORT_MACRO
+    #define UNIT_SYSTEM_EXPORT_MACRO
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "unit_system/config.hpp"
+
+
+// add all constants
+namespace sakurajin {
+    namespace unit_system {
+        namespace constants {
+
+            const long double avogadro_constant = 6.02214076e+23;
+
+            const long double water_freezing_point = 273.15;
+
+        } // namespace constants
+    } // namespace unit_system
+} // namespace sakurajin
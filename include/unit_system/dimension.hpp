@@ -0,0 +1,61 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <cstdint>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // the exponents of the SI base units of a unit, e.g. force is kg * m / s^2 -> {time -2, length 1, mass 1}.
+        // The layout is fixed (7 bytes) so it can be stored in files and shared memory.
+        struct dimension {
+            std::int8_t time               = 0;
+            std::int8_t length             = 0;
+            std::int8_t mass               = 0;
+            std::int8_t temperature        = 0;
+            std::int8_t amount             = 0;
+            std::int8_t electric_current   = 0;
+            std::int8_t luminous_intensity = 0;
+
+            friend constexpr bool operator==(const dimension&, const dimension&) = default;
+        };
+
+        static_assert(sizeof(dimension) == 7);
+
+        // the dimension of every unit of the library
+        template <class unit_t>
+        inline constexpr bool has_dimension = false;
+
+        template <class unit_t>
+        inline constexpr dimension dimension_of{};
+
+#define UNIT_SYSTEM_DIMENSION(unit_name, ...)                      \
+    template <class base_type>                                     \
+    inline constexpr bool has_dimension<unit_name<base_type>> = true; \
+    template <class base_type>                                     \
+    inline constexpr dimension dimension_of<unit_name<base_type>>{__VA_ARGS__};
+
+        UNIT_SYSTEM_DIMENSION(time_si_t, 1, 0, 0, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(length_t, 0, 1, 0, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(mass_t, 0, 0, 1, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(temperature_t, 0, 0, 0, 1, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(amount_t, 0, 0, 0, 0, 1, 0, 0)
+        UNIT_SYSTEM_DIMENSION(electric_current_t, 0, 0, 0, 0, 0, 1, 0)
+        UNIT_SYSTEM_DIMENSION(luminous_intensity_t, 0, 0, 0, 0, 0, 0, 1)
+        UNIT_SYSTEM_DIMENSION(area_t, 0, 2, 0, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(speed_t, -1, 1, 0, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(acceleration_t, -2, 1, 0, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(momentum_t, -1, 1, 1, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(force_t, -2, 1, 1, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(energy_t, -2, 2, 1, 0, 0, 0, 0)
+        UNIT_SYSTEM_DIMENSION(power_t, -3, 2, 1, 0, 0, 0, 0)
+
+#undef UNIT_SYSTEM_DIMENSION
+
+        template <class unit_t>
+        concept dimensioned_unit = unit_type<unit_t> && has_dimension<unit_t>;
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // Opt-in expression templates for chained products and quotients.
+        //
+        // Every operator* between two units converts both operands to offset 0 and builds a temporary with the product of the
+        // multipliers. Starting a chain with lazy() builds an expression instead, which is evaluated once when it is
+        // converted to its result type (or with eval()):
+        //
+        //     const power P = lazy(m1) * v1 * v2 / t1;
+        //
+        // The result type of each step is the type the normal operators would return, so only combinations the library
+        // defines compile. Offsets are only removed for operands that actually have one and the same rules as the normal
+        // operators apply: products and quotients of two units drop the offsets, products with scalars keep them.
+
+        namespace detail {
+
+            // value, multiplier and offset of a partially evaluated expression
+            template <std::floating_point base_type>
+            struct raw_unit {
+                base_type value;
+                base_type multiplier;
+                base_type offset;
+
+                // the value with the offset removed, what convert_offset(0) would return
+                base_type offset_free_value() const {
+                    if (offset == 0) [[likely]] {
+                        return value;
+                    }
+                    return (value * multiplier + offset) / multiplier;
+                }
+            };
+
+        } // namespace detail
+
+        template <class expr_t>
+        concept unit_expression = requires(const expr_t& expr) {
+            typename expr_t::unit_type;
+            typename expr_t::base_type;
+            { expr.raw() } -> std::same_as<detail::raw_unit<typename expr_t::base_type>>;
+        };
+
+        // the common part of all expressions: evaluating into the result type
+        template <class derived_t, class result_t, class base_t>
+        class expression_base {
+          public:
+            // the unit this expression evaluates to, or a floating point type for dimensionless results
+            using unit_type = result_t;
+            using base_type = base_t;
+
+            [[nodiscard]]
+            unit_type eval() const {
+                const auto raw = static_cast<const derived_t&>(*this).raw();
+                if constexpr (std::floating_point<unit_type>) {
+                    return static_cast<unit_type>(raw.value * raw.multiplier + raw.offset);
+                } else {
+                    return unit_type{raw.value, raw.multiplier, raw.offset};
+                }
+            }
+
+            // only units convert implicitly, so an expression is never mistaken for a scalar
+            operator unit_type() const
+                requires(!std::floating_point<unit_type>)
+            {
+                return eval();
+            }
+        };
+
+        template <unit_type unit_t>
+        class unit_leaf : public expression_base<unit_leaf<unit_t>, unit_t, unit_base_t<unit_t>> {
+            detail::raw_unit<unit_base_t<unit_t>> unit;
+
+          public:
+            explicit unit_leaf(const unit_t& value)
+                : unit{value.val(), value.mult(), value.off()} {}
+
+            detail::raw_unit<unit_base_t<unit_t>> raw() const { return unit; }
+        };
+
+        template <std::floating_point scalar_t>
+        class scalar_leaf : public expression_base<scalar_leaf<scalar_t>, scalar_t, scalar_t> {
+            scalar_t scalar;
+
+          public:
+            explicit scalar_leaf(scalar_t value)
+                : scalar{value} {}
+
+            detail::raw_unit<scalar_t> raw() const { return {scalar, 1, 0}; }
+        };
+
+        template <unit_expression lhs_t, unit_expression rhs_t>
+        using product_unit_t = decltype(std::declval<typename lhs_t::unit_type>() * std::declval<typename rhs_t::unit_type>());
+
+        template <unit_expression lhs_t, unit_expression rhs_t>
+        using quotient_unit_t = decltype(std::declval<typename lhs_t::unit_type>() / std::declval<typename rhs_t::unit_type>());
+
+        // scalars are cast to the base type of the unit they are combined with, like in the normal operators
+        template <unit_expression lhs_t, unit_expression rhs_t>
+        using common_base_t = std::conditional_t<
+            std::floating_point<typename rhs_t::unit_type> && !std::floating_point<typename lhs_t::unit_type>,
+            typename lhs_t::base_type,
+            std::conditional_t<std::floating_point<typename lhs_t::unit_type> && !std::floating_point<typename rhs_t::unit_type>,
+                               typename rhs_t::base_type,
+                               std::common_type_t<typename lhs_t::base_type, typename rhs_t::base_type>>>;
+
+        template <unit_expression lhs_t, unit_expression rhs_t>
+        class product_expression
+            : public expression_base<product_expression<lhs_t, rhs_t>, product_unit_t<lhs_t, rhs_t>, common_base_t<lhs_t, rhs_t>> {
+            using raw_base = common_base_t<lhs_t, rhs_t>;
+
+            lhs_t lhs;
+            rhs_t rhs;
+
+          public:
+            product_expression(const lhs_t& left, const rhs_t& right)
+                : lhs{left},
+                  rhs{right} {}
+
+            detail::raw_unit<raw_base> raw() const {
+                const auto l = lhs.raw();
+                const auto r = rhs.raw();
+                if constexpr (std::floating_point<typename rhs_t::unit_type>) {
+                    // unit * scalar keeps the offset of the unit
+                    return {static_cast<raw_base>(l.value * r.value * r.multiplier),
+                            static_cast<raw_base>(l.multiplier),
+                            static_cast<raw_base>(l.offset)};
+                } else if constexpr (std::floating_point<typename lhs_t::unit_type>) {
+                    return {static_cast<raw_base>(r.value * l.value * l.multiplier),
+                            static_cast<raw_base>(r.multiplier),
+                            static_cast<raw_base>(r.offset)};
+                } else {
+                    return {static_cast<raw_base>(l.offset_free_value() * r.offset_free_value()),
+                            static_cast<raw_base>(l.multiplier * r.multiplier),
+                            raw_base{0}};
+                }
+            }
+        };
+
+        template <unit_expression lhs_t, unit_expression rhs_t>
+        class quotient_expression
+            : public expression_base<quotient_expression<lhs_t, rhs_t>, quotient_unit_t<lhs_t, rhs_t>, common_base_t<lhs_t, rhs_t>> {
+            using raw_base = common_base_t<lhs_t, rhs_t>;
+
+            lhs_t lhs;
+            rhs_t rhs;
+
+          public:
+            quotient_expression(const lhs_t& left, const rhs_t& right)
+                : lhs{left},
+                  rhs{right} {}
+
+            detail::raw_unit<raw_base> raw() const {
+                const auto l = lhs.raw();
+                const auto r = rhs.raw();
+                if constexpr (std::floating_point<typename rhs_t::unit_type>) {
+                    // unit / scalar keeps the offset of the unit
+                    return {static_cast<raw_base>(l.value / (r.value * r.multiplier)),
+                            static_cast<raw_base>(l.multiplier),
+                            static_cast<raw_base>(l.offset)};
+                } else if constexpr (std::same_as<typename lhs_t::unit_type, typename rhs_t::unit_type>) {
+                    // the ratio of two values of the same unit, other is converted like this as in operator/
+                    const auto other = (r.value * r.multiplier + (r.offset - l.offset)) / l.multiplier;
+                    return {static_cast<raw_base>(l.value / other), raw_base{1}, raw_base{0}};
+                } else {
+                    return {static_cast<raw_base>(l.offset_free_value() / r.offset_free_value()),
+                            static_cast<raw_base>(l.multiplier / r.multiplier),
+                            raw_base{0}};
+                }
+            }
+        };
+
+        // starts an expression chain
+        template <unit_type unit_t>
+        unit_leaf<unit_t> lazy(const unit_t& unit) {
+            return unit_leaf<unit_t>{unit};
+        }
+
+        namespace detail {
+
+            // units and scalars are wrapped into leaves when they are combined with an expression
+            template <class operand_t>
+            auto as_expression(const operand_t& operand) {
+                if constexpr (unit_expression<operand_t>) {
+                    return operand;
+                } else if constexpr (unit_type<operand_t>) {
+                    return unit_leaf<operand_t>{operand};
+                } else if constexpr (std::floating_point<operand_t>) {
+                    return scalar_leaf<operand_t>{operand};
+                } else {
+                    return scalar_leaf<double>{static_cast<double>(operand)};
+                }
+            }
+
+            template <class operand_t>
+            concept expression_operand = unit_expression<operand_t> || unit_type<operand_t> || std::is_arithmetic_v<operand_t>;
+
+            template <class lhs_t, class rhs_t>
+            concept expression_operands =
+                expression_operand<lhs_t> && expression_operand<rhs_t> && (unit_expression<lhs_t> || unit_expression<rhs_t>);
+
+        } // namespace detail
+
+        template <class lhs_t, class rhs_t>
+            requires detail::expression_operands<lhs_t, rhs_t>
+        auto operator*(const lhs_t& lhs, const rhs_t& rhs)
+            -> product_expression<decltype(detail::as_expression(lhs)), decltype(detail::as_expression(rhs))> {
+            return {detail::as_expression(lhs), detail::as_expression(rhs)};
+        }
+
+        template <class lhs_t, class rhs_t>
+            requires detail::expression_operands<lhs_t, rhs_t>
+        auto operator/(const lhs_t& lhs, const rhs_t& rhs)
+            -> quotient_expression<decltype(detail::as_expression(lhs)), decltype(detail::as_expression(rhs))> {
+            return {detail::as_expression(lhs), detail::as_expression(rhs)};
+        }
+
+        template <unit_expression expr_t>
+        [[nodiscard]]
+        auto eval(const expr_t& expr) {
+            return expr.eval();
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // A predicate of the form lower <= x <= upper (each bound optional, inclusive or exclusive).
+        // Alarm rules like `x > 80_C` or `3_mps <= x <= 5_mps` are all ranges, and so is the conjunction of two ranges.
+        // Instead of converting the threshold for every element like operator< does, the bounds are converted into the unit
+        // of the data once (bind) and every element is then checked with two plain floating point compares.
+        template <unit_type unit_t>
+        class range_predicate {
+          public:
+            using base_type = unit_base_t<unit_t>;
+
+            // the bounds of a predicate converted into the raw values of one multiplier and offset
+            struct bound_range {
+                base_type lower{-std::numeric_limits<base_type>::infinity()};
+                base_type upper{std::numeric_limits<base_type>::infinity()};
+
+                bool operator()(base_type raw) const { return (raw >= lower) & (raw <= upper); }
+            };
+
+          private:
+            std::optional<unit_t> lower;
+            std::optional<unit_t> upper;
+            bool                  lower_inclusive{true};
+            bool                  upper_inclusive{true};
+
+          public:
+            // the default predicate accepts every value except NaN
+            range_predicate() = default;
+
+            range_predicate(std::optional<unit_t> lower_bound, bool lower_incl, std::optional<unit_t> upper_bound, bool upper_incl)
+                : lower{std::move(lower_bound)},
+                  upper{std::move(upper_bound)},
+                  lower_inclusive{lower_incl},
+                  upper_inclusive{upper_incl} {}
+
+            const std::optional<unit_t>& lower_bound() const { return lower; }
+            const std::optional<unit_t>& upper_bound() const { return upper; }
+            bool                         is_lower_inclusive() const { return lower_inclusive; }
+            bool                         is_upper_inclusive() const { return upper_inclusive; }
+
+            // converts the bounds into raw values with the given multiplier and offset.
+            // Exclusive bounds are moved to the next representable value, so the check is always two inclusive compares.
+            [[nodiscard]]
+            bound_range bind(base_type multiplier, base_type offset) const {
+                bound_range range{};
+                if (lower) {
+                    range.lower = lower->convert_copy(multiplier, offset).val();
+                    if (!lower_inclusive) {
+                        range.lower = std::nextafter(range.lower, std::numeric_limits<base_type>::infinity());
+                    }
+                }
+                if (upper) {
+                    range.upper = upper->convert_copy(multiplier, offset).val();
+                    if (!upper_inclusive) {
+                        range.upper = std::nextafter(range.upper, -std::numeric_limits<base_type>::infinity());
+                    }
+                }
+                return range;
+            }
+
+            [[nodiscard]]
+            bound_range bind(const unit_t& like) const {
+                return bind(like.mult(), like.off());
+            }
+
+            bool operator()(const unit_t& value) const { return bind(value)(value.val()); }
+
+            // the conjunction of two ranges is the range between the tighter bounds
+            range_predicate operator&&(const range_predicate& other) const {
+                auto retval = *this;
+                if (other.lower && (!retval.lower || *other.lower > *retval.lower)) {
+                    retval.lower           = other.lower;
+                    retval.lower_inclusive = other.lower_inclusive;
+                } else if (other.lower && *other.lower == *retval.lower) {
+                    retval.lower_inclusive = retval.lower_inclusive && other.lower_inclusive;
+                }
+                if (other.upper && (!retval.upper || *other.upper < *retval.upper)) {
+                    retval.upper           = other.upper;
+                    retval.upper_inclusive = other.upper_inclusive;
+                } else if (other.upper && *other.upper == *retval.upper) {
+                    retval.upper_inclusive = retval.upper_inclusive && other.upper_inclusive;
+                }
+                return retval;
+            }
+
+            // kernels over raw columns that share one multiplier and offset (the fast path for telemetry tables).
+            // Every kernel can run with an execution policy, the results do not depend on the policy.
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::size_t count(const policy_t& policy, std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                const auto               range = bind(multiplier, offset);
+                std::atomic<std::size_t> total{0};
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    std::size_t found = 0;
+                    for (std::size_t i = begin; i < end; ++i) {
+                        found += range(values[i]);
+                    }
+                    total.fetch_add(found, std::memory_order_relaxed);
+                });
+                return total.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]]
+            std::size_t count(std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                return count(seq, values, multiplier, offset);
+            }
+
+            // writes one bit per value into out (bit i % 64 of word i / 64).
+            // Like the other batch kernels it stops at the shorter side, only the first out.size() * 64 values are checked.
+            template <execution_policy policy_t>
+            void bitmask(const policy_t&            policy,
+                         std::span<const base_type> values,
+                         base_type                  multiplier,
+                         base_type                  offset,
+                         std::span<std::uint64_t>   out) const {
+                values           = values.first(std::min(values.size(), out.size() * 64));
+                const auto range = bind(multiplier, offset);
+                const auto words = (values.size() + 63) / 64;
+                for_each_range(detail::grain_per_item(policy, 64), words, [&](std::size_t first, std::size_t last) {
+                    for (std::size_t word = first; word < last; ++word) {
+                        const auto    begin = word * 64;
+                        const auto    end   = std::min(begin + 64, values.size());
+                        std::uint64_t bits  = 0;
+                        for (std::size_t i = begin; i < end; ++i) {
+                            bits |= static_cast<std::uint64_t>(range(values[i])) << (i - begin);
+                        }
+                        out[word] = bits;
+                    }
+                });
+            }
+
+            void bitmask(std::span<const base_type> values, base_type multiplier, base_type offset, std::span<std::uint64_t> out) const {
+                bitmask(seq, values, multiplier, offset, out);
+            }
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::vector<std::uint64_t> bitmask(const policy_t& policy, std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                std::vector<std::uint64_t> retval((values.size() + 63) / 64);
+                bitmask(policy, values, multiplier, offset, retval);
+                return retval;
+            }
+
+            [[nodiscard]]
+            std::vector<std::uint64_t> bitmask(std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                return bitmask(seq, values, multiplier, offset);
+            }
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::vector<std::size_t> indices(const policy_t& policy, std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                const auto range = bind(multiplier, offset);
+                return collect_indices(policy, values.size(), [&](std::size_t begin, std::size_t end, auto&& sink) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        sink(i, range(values[i]));
+                    }
+                });
+            }
+
+            [[nodiscard]]
+            std::vector<std::size_t> indices(std::span<const base_type> values, base_type multiplier, base_type offset) const {
+                return indices(seq, values, multiplier, offset);
+            }
+
+            // kernels over unit arrays, the bounds are converted again only when the unit of the elements changes
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::size_t count(const policy_t& policy, std::span<const unit_t> values) const {
+                std::atomic<std::size_t> total{0};
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    std::size_t found = 0;
+                    scan(values.subspan(begin, end - begin), [&found](std::size_t, bool match) { found += match; });
+                    total.fetch_add(found, std::memory_order_relaxed);
+                });
+                return total.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]]
+            std::size_t count(std::span<const unit_t> values) const {
+                return count(seq, values);
+            }
+
+            // only the first out.size() * 64 values are checked, the same as for raw columns
+            template <execution_policy policy_t>
+            void bitmask(const policy_t& policy, std::span<const unit_t> values, std::span<std::uint64_t> out) const {
+                values           = values.first(std::min(values.size(), out.size() * 64));
+                const auto words = (values.size() + 63) / 64;
+                // every range covers whole words, so no two threads write to the same word
+                for_each_range(detail::grain_per_item(policy, 64), words, [&](std::size_t first, std::size_t last) {
+                    std::fill(out.begin() + static_cast<std::ptrdiff_t>(first), out.begin() + static_cast<std::ptrdiff_t>(last), std::uint64_t{0});
+                    const auto begin = first * 64;
+                    const auto end   = std::min(last * 64, values.size());
+                    scan(values.subspan(begin, end - begin), [&out, begin](std::size_t i, bool match) {
+                        out[(begin + i) / 64] |= static_cast<std::uint64_t>(match) << ((begin + i) % 64);
+                    });
+                });
+            }
+
+            void bitmask(std::span<const unit_t> values, std::span<std::uint64_t> out) const { bitmask(seq, values, out); }
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::vector<std::uint64_t> bitmask(const policy_t& policy, std::span<const unit_t> values) const {
+                std::vector<std::uint64_t> retval((values.size() + 63) / 64);
+                bitmask(policy, values, retval);
+                return retval;
+            }
+
+            [[nodiscard]]
+            std::vector<std::uint64_t> bitmask(std::span<const unit_t> values) const {
+                return bitmask(seq, values);
+            }
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::vector<std::size_t> indices(const policy_t& policy, std::span<const unit_t> values) const {
+                return collect_indices(policy, values.size(), [&](std::size_t begin, std::size_t end, auto&& sink) {
+                    scan(values.subspan(begin, end - begin), [&sink, begin](std::size_t i, bool match) { sink(begin + i, match); });
+                });
+            }
+
+            [[nodiscard]]
+            std::vector<std::size_t> indices(std::span<const unit_t> values) const {
+                return indices(seq, values);
+            }
+
+          private:
+            template <class sink_t>
+            void scan(std::span<const unit_t> values, sink_t&& sink) const {
+                if (values.empty()) {
+                    return;
+                }
+                auto multiplier = values.front().mult();
+                auto offset     = values.front().off();
+                auto range      = bind(multiplier, offset);
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    const auto& value = values[i];
+                    if (value.mult() != multiplier || value.off() != offset) [[unlikely]] {
+                        multiplier = value.mult();
+                        offset     = value.off();
+                        range      = bind(multiplier, offset);
+                    }
+                    sink(i, range(value.val()));
+                }
+            }
+
+            // the indices of all matches, scan_range(begin, end, sink) calls sink(i, match) for every i in [begin, end).
+            // With more than one chunk the matches of every chunk are counted first, so every chunk knows where its indices go.
+            template <execution_policy policy_t, class scan_t>
+            static std::vector<std::size_t> collect_indices(const policy_t& policy, std::size_t size, const scan_t& scan_range) {
+                const auto               chunk  = detail::chunk_size(policy, size);
+                const auto               chunks = (size + chunk - 1) / chunk;
+                std::vector<std::size_t> retval;
+                if (chunks <= 1) {
+                    // branch free, every index is written and only the matches advance the end
+                    retval.resize(size);
+                    std::size_t found = 0;
+                    scan_range(std::size_t{0}, size, [&](std::size_t i, bool match) {
+                        retval[found] = i;
+                        found += match;
+                    });
+                    retval.resize(found);
+                    return retval;
+                }
+
+                std::vector<std::size_t> offsets(chunks + 1);
+                const auto               chunk_policy = detail::grain_per_item(policy, chunk);
+                for_each_range(chunk_policy, chunks, [&](std::size_t first, std::size_t last) {
+                    for (std::size_t c = first; c < last; ++c) {
+                        std::size_t found = 0;
+                        scan_range(c * chunk, std::min(size, (c + 1) * chunk), [&found](std::size_t, bool match) { found += match; });
+                        offsets[c + 1] = found;
+                    }
+                });
+                std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+                // the chunks write next to each other, so only the matches may be written here
+                retval.resize(offsets.back());
+                for_each_range(chunk_policy, chunks, [&](std::size_t first, std::size_t last) {
+                    for (std::size_t c = first; c < last; ++c) {
+                        auto position = offsets[c];
+                        scan_range(c * chunk, std::min(size, (c + 1) * chunk), [&](std::size_t i, bool match) {
+                            if (match) {
+                                retval[position++] = i;
+                            }
+                        });
+                    }
+                });
+                return retval;
+            }
+        };
+
+        template <unit_type unit_t>
+        range_predicate<unit_t> above(const unit_t& threshold) {
+            return range_predicate<unit_t>{threshold, false, std::nullopt, true};
+        }
+
+        template <unit_type unit_t>
+        range_predicate<unit_t> at_least(const unit_t& threshold) {
+            return range_predicate<unit_t>{threshold, true, std::nullopt, true};
+        }
+
+        template <unit_type unit_t>
+        range_predicate<unit_t> below(const unit_t& threshold) {
+            return range_predicate<unit_t>{std::nullopt, true, threshold, false};
+        }
+
+        template <unit_type unit_t>
+        range_predicate<unit_t> at_most(const unit_t& threshold) {
+            return range_predicate<unit_t>{std::nullopt, true, threshold, true};
+        }
+
+        // lower <= x <= upper, the same bounds std::clamp uses
+        template <unit_type unit_t>
+        range_predicate<unit_t> between(const unit_t& lower, const unit_t& upper) {
+            return range_predicate<unit_t>{lower, true, upper, true};
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // the result of a * b, only defined for the unit pairs the library has an operator* for
+        template <unit_type a_t, unit_type b_t>
+        using product_t = decltype(std::declval<const a_t&>() * std::declval<const b_t&>());
+
+        template <class a_t, class b_t, class c_t>
+        concept fma_compatible = unit_type<a_t> && unit_type<b_t> && unit_type<c_t> && requires(const a_t& a, const b_t& b) {
+            { a * b } -> std::same_as<c_t>;
+        };
+
+        namespace detail {
+
+            // if std::fma maps to a hardware instruction for the type
+            template <std::floating_point base_type>
+            inline constexpr bool has_fast_fma = false;
+#ifdef FP_FAST_FMAF
+            template <>
+            inline constexpr bool has_fast_fma<float> = true;
+#endif
+#ifdef FP_FAST_FMA
+            template <>
+            inline constexpr bool has_fast_fma<double> = true;
+#endif
+#ifdef FP_FAST_FMAL
+            template <>
+            inline constexpr bool has_fast_fma<long double> = true;
+#endif
+
+            // a * b + c with a single rounding if the target has a fused multiply add instruction,
+            // otherwise the software std::fma would be far slower than the rounding it saves
+            template <std::floating_point base_type>
+            base_type fused_multiply_add(base_type a, base_type b, base_type c) {
+                if constexpr (has_fast_fma<base_type>) {
+                    return std::fma(a, b, c);
+                } else {
+                    return a * b + c;
+                }
+            }
+
+            // the value of a unit with its offset removed, what the product operators get from convert_offset(0)
+            template <unit_type unit_t>
+            unit_base_t<unit_t> offset_free_value(const unit_t& unit) {
+                if (unit.off() == 0) [[likely]] {
+                    return unit.val();
+                }
+                return unit.convert_offset(0).val();
+            }
+
+            // caches the factor between the multiplier of a * b and the multiplier of c,
+            // so arrays with the same units for every element only divide once
+            template <std::floating_point base_type>
+            class fma_scale {
+                base_type a_mult{1};
+                base_type b_mult{1};
+                base_type c_mult{1};
+                base_type factor{1};
+
+              public:
+                base_type get(base_type a, base_type b, base_type c) {
+                    if (a != a_mult || b != b_mult || c != c_mult) [[unlikely]] {
+                        a_mult = a;
+                        b_mult = b;
+                        c_mult = c;
+                        factor = a * b / c;
+                    }
+                    return factor;
+                }
+            };
+
+        } // namespace detail
+
+        // a * b + c without the temporary of operator*, the result has the multiplier and offset of c.
+        // If the multipliers of a and b multiply to the one of c (e.g. mass in kg, acceleration in m/s^2 and force in N)
+        // the scaling is exact and this is a single fused multiply add.
+        template <unit_type a_t, unit_type b_t, unit_type c_t>
+            requires fma_compatible<a_t, b_t, c_t>
+        [[nodiscard]]
+        c_t fma(const a_t& a, const b_t& b, const c_t& c) {
+            using base_type   = unit_base_t<c_t>;
+            const auto factor = static_cast<base_type>(a.mult() * b.mult()) / c.mult();
+            const auto va     = static_cast<base_type>(detail::offset_free_value(a));
+            const auto vb     = static_cast<base_type>(detail::offset_free_value(b));
+
+            return c_t{detail::fused_multiply_add(va * factor, vb, c.val()), c.mult(), c.off()};
+        }
+
+        // c[i] = a[i] * b[i] + c[i] for whole arrays, for example F = m * a + F0
+        template <execution_policy policy_t, unit_range a_range, unit_range b_range, unit_range c_range>
+            requires fma_compatible<std::ranges::range_value_t<a_range>,
+                                    std::ranges::range_value_t<b_range>,
+                                    std::ranges::range_value_t<c_range>>
+        void fma(const policy_t& policy, const a_range& a, const b_range& b, c_range&& c) {
+            using base_type = unit_base_t<std::ranges::range_value_t<c_range>>;
+
+            std::span  a_values{a};
+            std::span  b_values{b};
+            std::span  c_values{c};
+            const auto count = std::min({a_values.size(), b_values.size(), c_values.size()});
+
+            for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                detail::fma_scale<base_type> scale;
+                for (std::size_t i = begin; i < end; ++i) {
+                    const auto& ai     = a_values[i];
+                    const auto& bi     = b_values[i];
+                    auto&       ci     = c_values[i];
+                    const auto  factor = scale.get(ai.mult(), bi.mult(), ci.mult());
+                    const auto  va     = static_cast<base_type>(detail::offset_free_value(ai));
+                    const auto  vb     = static_cast<base_type>(detail::offset_free_value(bi));
+                    ci.val()           = detail::fused_multiply_add(va * factor, vb, ci.val());
+                }
+            });
+        }
+
+        template <unit_range a_range, unit_range b_range, unit_range c_range>
+            requires fma_compatible<std::ranges::range_value_t<a_range>,
+                                    std::ranges::range_value_t<b_range>,
+                                    std::ranges::range_value_t<c_range>>
+        void fma(const a_range& a, const b_range& b, c_range&& c) {
+            fma(seq, a, b, std::forward<c_range>(c));
+        }
+
+        // c[i] = a[i] * b + c[i] for whole arrays, for example E = P * dt + E0
+        template <execution_policy policy_t, unit_range a_range, unit_type b_t, unit_range c_range>
+            requires fma_compatible<std::ranges::range_value_t<a_range>, b_t, std::ranges::range_value_t<c_range>>
+        void fma(const policy_t& policy, const a_range& a, const b_t& b, c_range&& c) {
+            using base_type = unit_base_t<std::ranges::range_value_t<c_range>>;
+
+            std::span  a_values{a};
+            std::span  c_values{c};
+            const auto count = std::min(a_values.size(), c_values.size());
+            const auto vb    = static_cast<base_type>(detail::offset_free_value(b));
+
+            for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                detail::fma_scale<base_type> scale;
+                for (std::size_t i = begin; i < end; ++i) {
+                    const auto& ai     = a_values[i];
+                    auto&       ci     = c_values[i];
+                    const auto  factor = scale.get(ai.mult(), b.mult(), ci.mult());
+                    const auto  va     = static_cast<base_type>(detail::offset_free_value(ai));
+                    ci.val()           = detail::fused_multiply_add(va * factor, vb, ci.val());
+                }
+            });
+        }
+
+        template <unit_range a_range, unit_type b_t, unit_range c_range>
+            requires fma_compatible<std::ranges::range_value_t<a_range>, b_t, std::ranges::range_value_t<c_range>>
+        void fma(const a_range& a, const b_t& b, c_range&& c) {
+            fma(seq, a, b, std::forward<c_range>(c));
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
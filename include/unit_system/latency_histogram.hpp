@@ -0,0 +1,204 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // An HDR style histogram of durations, e.g. the latencies of all requests of a server.
+        //
+        // Durations are rounded to the nearest tick of the resolution. Below 2^precision_bits ticks every tick has its own bucket,
+        // above that every power of two is split into 2^precision_bits buckets, so every value is stored with a relative error
+        // of at most 2^-precision_bits (0.8% with the default of 7 bits) and 1 ns to 1 h needs fewer than 5000 buckets.
+        // record converts the duration with any multiplier (_ns, _us, _ms, ...) and increments one bucket with a relaxed atomic add,
+        // so any number of threads can record at the same time. For the least contention every thread records into its own
+        // histogram and they are merged for the report, merging adds the buckets of two histograms.
+        // Durations below 0 are counted as 0, durations above the highest trackable value in the last bucket.
+        template <unit_type unit_t = time_si>
+            requires std::same_as<unit_t, time_si_t<unit_base_t<unit_t>>>
+        class latency_histogram {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+          private:
+            base_type                                    resolution_seconds;
+            base_type                                    ticks_per_second;
+            unsigned                                     precision;
+            std::uint64_t                                sub_count;
+            std::uint64_t                                max_ticks;
+            std::size_t                                  bucket_count;
+            std::unique_ptr<std::atomic<std::uint64_t>[]> counts;
+
+            [[nodiscard]]
+            std::size_t index_of(std::uint64_t ticks) const noexcept {
+                if (ticks < sub_count) {
+                    return static_cast<std::size_t>(ticks);
+                }
+                const auto shift = static_cast<unsigned>(std::bit_width(ticks)) - 1 - precision;
+                return static_cast<std::size_t>(sub_count + shift * sub_count + ((ticks >> shift) - sub_count));
+            }
+
+            // the largest number of ticks that is counted in the bucket
+            [[nodiscard]]
+            std::uint64_t highest_ticks(std::size_t index) const noexcept {
+                if (index < sub_count) {
+                    return index;
+                }
+                const auto shift = (index - sub_count) / sub_count;
+                const auto top   = sub_count + (index - sub_count) % sub_count;
+                return ((top + 1) << shift) - 1;
+            }
+
+            [[nodiscard]]
+            std::uint64_t lowest_ticks(std::size_t index) const noexcept {
+                return index == 0 ? 0 : highest_ticks(index - 1) + 1;
+            }
+
+            [[nodiscard]]
+            unit_t from_ticks(std::uint64_t ticks) const noexcept {
+                return unit_t{static_cast<base_type>(ticks) * resolution_seconds, 1, 0};
+            }
+
+          public:
+            // tracks durations from resolution to highest with a relative error of 2^-precision_bits
+            explicit latency_histogram(const unit_t& resolution     = unit_t{1, 1e-9, 0},
+                                       const unit_t& highest        = unit_t{1, 3600, 0},
+                                       unsigned      precision_bits = 7)
+                : resolution_seconds{base_value(resolution)},
+                  ticks_per_second{1 / resolution_seconds},
+                  precision{std::clamp(precision_bits, 1u, 16u)},
+                  sub_count{std::uint64_t{1} << precision},
+                  max_ticks{0},
+                  bucket_count{0} {
+                if (!(resolution_seconds > 0) || !(base_value(highest) > resolution_seconds)) {
+                    throw std::invalid_argument{"the resolution has to be positive and smaller than the highest trackable value"};
+                }
+                const auto highest_ticks_value = std::ceil(base_value(highest) * ticks_per_second);
+                if (highest_ticks_value >= static_cast<base_type>(std::uint64_t{1} << 62)) {
+                    throw std::invalid_argument{"the highest trackable value needs more than 2^62 ticks of the resolution"};
+                }
+                max_ticks    = std::max(static_cast<std::uint64_t>(highest_ticks_value), sub_count);
+                bucket_count = index_of(max_ticks) + 1;
+                counts       = std::make_unique<std::atomic<std::uint64_t>[]>(bucket_count);
+            }
+
+            latency_histogram(const latency_histogram&)            = delete;
+            latency_histogram& operator=(const latency_histogram&) = delete;
+
+            [[nodiscard]]
+            std::size_t buckets() const noexcept {
+                return bucket_count;
+            }
+
+            // counts a duration, can be called from any number of threads
+            void record(const unit_t& duration, std::uint64_t count = 1) noexcept {
+                const auto    scaled = base_value(duration) * ticks_per_second;
+                std::uint64_t ticks  = 0;
+                if (scaled >= static_cast<base_type>(max_ticks)) {
+                    ticks = max_ticks;
+                } else if (scaled > 0) {
+                    ticks = static_cast<std::uint64_t>(scaled + static_cast<base_type>(0.5));
+                }
+                counts[index_of(ticks)].fetch_add(count, std::memory_order_relaxed);
+            }
+
+            // adds the counts of other, both need the same resolution, highest trackable value and precision
+            void merge(const latency_histogram& other) {
+                if (other.resolution_seconds != resolution_seconds || other.bucket_count != bucket_count || other.precision != precision) {
+                    throw std::invalid_argument{"only histograms with the same resolution, range and precision can be merged"};
+                }
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    const auto count = other.counts[i].load(std::memory_order_relaxed);
+                    if (count != 0) {
+                        counts[i].fetch_add(count, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            void reset() noexcept {
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    counts[i].store(0, std::memory_order_relaxed);
+                }
+            }
+
+            // the number of recorded durations
+            [[nodiscard]]
+            std::uint64_t count() const noexcept {
+                std::uint64_t total = 0;
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    total += counts[i].load(std::memory_order_relaxed);
+                }
+                return total;
+            }
+
+            // the duration that percentile percent of the recorded durations are at most, as the highest value of its bucket
+            [[nodiscard]]
+            unit_t percentile(double percent) const noexcept {
+                const auto total = count();
+                if (total == 0) {
+                    return unit_t{0, 1, 0};
+                }
+                const auto    fraction = std::clamp(percent, 0.0, 100.0) / 100.0;
+                const auto    target   = std::max<std::uint64_t>(static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(total))), 1);
+                std::uint64_t seen     = 0;
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    seen += counts[i].load(std::memory_order_relaxed);
+                    if (seen >= target) {
+                        return from_ticks(highest_ticks(i));
+                    }
+                }
+                return from_ticks(highest_ticks(bucket_count - 1));
+            }
+
+            // the lower bound of the lowest bucket with a recorded duration
+            [[nodiscard]]
+            unit_t min() const noexcept {
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    if (counts[i].load(std::memory_order_relaxed) != 0) {
+                        return from_ticks(lowest_ticks(i));
+                    }
+                }
+                return unit_t{0, 1, 0};
+            }
+
+            // the upper bound of the highest bucket with a recorded duration
+            [[nodiscard]]
+            unit_t max() const noexcept {
+                for (std::size_t i = bucket_count; i > 0; --i) {
+                    if (counts[i - 1].load(std::memory_order_relaxed) != 0) {
+                        return from_ticks(highest_ticks(i - 1));
+                    }
+                }
+                return unit_t{0, 1, 0};
+            }
+
+            // the mean of all recorded durations, every duration counts as the middle of its bucket
+            [[nodiscard]]
+            unit_t mean() const noexcept {
+                base_type     sum   = 0;
+                std::uint64_t total = 0;
+                for (std::size_t i = 0; i < bucket_count; ++i) {
+                    const auto count = counts[i].load(std::memory_order_relaxed);
+                    if (count != 0) {
+                        const auto middle = (static_cast<base_type>(lowest_ticks(i)) + static_cast<base_type>(highest_ticks(i))) / 2;
+                        sum += middle * static_cast<base_type>(count);
+                        total += count;
+                    }
+                }
+                return unit_t{total == 0 ? 0 : sum / static_cast<base_type>(total) * resolution_seconds, 1, 0};
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
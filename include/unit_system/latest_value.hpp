@@ -0,0 +1,90 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // The most recent value of a unit that one thread updates and any number of threads read, e.g. the current speed of a
+        // control loop shown on a dashboard.
+        //
+        // This is a seqlock: the writer increments a sequence number before and after it copies the unit, a reader copies the
+        // unit and retries if the sequence number was odd or changed in between. The whole unit (value, multiplier and offset)
+        // is copied as 64 bit words with relaxed atomics, so a reader never sees a mix of two stores.
+        // store is wait-free and never waits for readers, readers never write to shared memory, so they do not slow down each other.
+        // The cell is aligned to and padded to whole cache lines, so neighbouring data does not cause false sharing.
+        // Only one thread may call store at the same time.
+        template <unit_type unit_t>
+            requires std::is_trivially_copyable_v<unit_t> && (sizeof(unit_t) % sizeof(std::uint64_t) == 0)
+        class alignas(cache_line_size) latest_value {
+            static constexpr std::size_t word_count = sizeof(unit_t) / sizeof(std::uint64_t);
+            using words_type                         = std::array<std::uint64_t, word_count>;
+
+            std::atomic<std::uint64_t>                          sequence{0};
+            std::array<std::atomic<std::uint64_t>, word_count> words;
+
+            // memcpy instead of std::bit_cast, long double has padding bytes and bit_cast of those is undefined
+            void write(const unit_t& unit) noexcept {
+                words_type data{};
+                std::memcpy(data.data(), &unit, sizeof(unit_t));
+                for (std::size_t i = 0; i < word_count; ++i) {
+                    words[i].store(data[i], std::memory_order_relaxed);
+                }
+            }
+
+          public:
+            using unit_type = unit_t;
+
+            explicit latest_value(const unit_t& initial = unit_t{0, 1, 0}) noexcept { write(initial); }
+
+            latest_value(const latest_value&)            = delete;
+            latest_value& operator=(const latest_value&) = delete;
+
+            // publishes unit, only one thread may store at the same time
+            void store(const unit_t& unit) noexcept {
+                const auto current = sequence.load(std::memory_order_relaxed);
+                sequence.store(current + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                write(unit);
+                sequence.store(current + 2, std::memory_order_release);
+            }
+
+            // the last stored unit, retries while a store is running
+            [[nodiscard]]
+            unit_t load() const noexcept {
+                words_type data;
+                while (true) {
+                    const auto before = sequence.load(std::memory_order_acquire);
+                    if (before % 2 == 0) {
+                        for (std::size_t i = 0; i < word_count; ++i) {
+                            data[i] = words[i].load(std::memory_order_relaxed);
+                        }
+                        std::atomic_thread_fence(std::memory_order_acquire);
+                        if (sequence.load(std::memory_order_relaxed) == before) {
+                            unit_t unit{0, 1, 0};
+                            std::memcpy(static_cast<void*>(&unit), data.data(), sizeof(unit_t));
+                            return unit;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+            }
+
+            // the number of stores so far, a reader can skip load if it did not change
+            [[nodiscard]]
+            std::uint64_t version() const noexcept {
+                return sequence.load(std::memory_order_acquire) / 2;
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
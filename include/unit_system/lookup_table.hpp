@@ -0,0 +1,249 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        enum class interpolation {
+            linear,
+            // cubic hermite spline with tangents from the neighbouring samples (catmull-rom on uniform grids)
+            cubic,
+        };
+
+        // A sampled curve y(x), for example force over length for a spring or power over speed for a fan.
+        // Keys and values are stored in base units, so evaluating never converts a multiplier.
+        // Inputs outside the sampled range are clamped to the first or last sample, a NaN input gives a NaN value.
+        //
+        // If the keys are equally spaced the segment is computed directly from the key,
+        // otherwise it is found with a branch free binary search over the keys in eytzinger (breadth first) order,
+        // which keeps the first levels of the search in a few cache lines.
+        template <unit_type x_t, unit_type y_t>
+        class lookup_table {
+          public:
+            using x_base = unit_base_t<x_t>;
+            using y_base = unit_base_t<y_t>;
+
+          private:
+            interpolation mode;
+
+            // the samples sorted by key, all in base units
+            std::vector<x_base> keys;
+            std::vector<y_base> values;
+            // the slope of each segment for linear interpolation, the tangent at each key for cubic interpolation
+            std::vector<y_base> slopes;
+
+            // 1 based eytzinger layout of the keys and the sorted index of each entry
+            std::vector<x_base>      eytzinger_keys;
+            std::vector<std::size_t> eytzinger_index;
+
+            bool   uniform{false};
+            x_base inv_step{0};
+
+          public:
+            lookup_table(std::span<const x_t> x, std::span<const y_t> y, interpolation type = interpolation::linear)
+                : mode{type} {
+                if (x.size() != y.size()) {
+                    throw std::invalid_argument("lookup_table needs the same number of keys and values");
+                }
+                if (x.size() < 2) {
+                    throw std::invalid_argument("lookup_table needs at least two samples");
+                }
+
+                std::vector<std::size_t> order(x.size());
+                std::iota(order.begin(), order.end(), std::size_t{0});
+                std::stable_sort(order.begin(), order.end(), [&x](std::size_t a, std::size_t b) {
+                    return base_value(x[a]) < base_value(x[b]);
+                });
+
+                keys.reserve(x.size());
+                values.reserve(y.size());
+                for (const auto index : order) {
+                    keys.push_back(base_value(x[index]));
+                    values.push_back(static_cast<y_base>(base_value(y[index])));
+                }
+                if (std::adjacent_find(keys.begin(), keys.end()) != keys.end()) {
+                    throw std::invalid_argument("lookup_table keys have to be unique");
+                }
+
+                compute_slopes();
+                build_eytzinger();
+                detect_uniform_grid();
+            }
+
+            lookup_table(const std::vector<x_t>& x, const std::vector<y_t>& y, interpolation type = interpolation::linear)
+                : lookup_table{std::span<const x_t>{x}, std::span<const y_t>{y}, type} {}
+
+            [[nodiscard]]
+            std::size_t size() const {
+                return keys.size();
+            }
+
+            [[nodiscard]]
+            bool is_uniform() const {
+                return uniform;
+            }
+
+            [[nodiscard]]
+            interpolation interpolation_mode() const {
+                return mode;
+            }
+
+            // evaluates the curve for a key given in base units and returns the value in base units
+            [[nodiscard]]
+            y_base evaluate_raw(x_base x) const {
+                // std::clamp keeps NaN and the segment index of NaN would be undefined
+                if (std::isnan(x)) {
+                    return std::numeric_limits<y_base>::quiet_NaN();
+                }
+                x                  = std::clamp(x, keys.front(), keys.back());
+                const auto segment = find_segment(x);
+                return interpolate(segment, x);
+            }
+
+            [[nodiscard]]
+            y_t evaluate(const x_t& x) const {
+                return y_t{evaluate_raw(base_value(x)), 1.0, 0.0};
+            }
+
+            y_t operator()(const x_t& x) const { return evaluate(x); }
+
+            // batch evaluation, the searches of the elements are independent so their memory accesses overlap,
+            // with an execution policy the elements are split over the threads of a pool
+            template <execution_policy policy_t>
+            void evaluate_raw(const policy_t& policy, std::span<const x_base> x, std::span<y_base> out) const {
+                const auto count = std::min(x.size(), out.size());
+                for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        out[i] = evaluate_raw(x[i]);
+                    }
+                });
+            }
+
+            void evaluate_raw(std::span<const x_base> x, std::span<y_base> out) const { evaluate_raw(seq, x, out); }
+
+            template <execution_policy policy_t>
+            void evaluate(const policy_t& policy, std::span<const x_t> x, std::span<y_t> out) const {
+                const auto count = std::min(x.size(), out.size());
+                for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        out[i] = evaluate(x[i]);
+                    }
+                });
+            }
+
+            void evaluate(std::span<const x_t> x, std::span<y_t> out) const { evaluate(seq, x, out); }
+
+            template <execution_policy policy_t>
+            [[nodiscard]]
+            std::vector<y_t> evaluate(const policy_t& policy, std::span<const x_t> x) const {
+                std::vector<y_t> retval(x.size());
+                evaluate(policy, x, retval);
+                return retval;
+            }
+
+            [[nodiscard]]
+            std::vector<y_t> evaluate(std::span<const x_t> x) const {
+                return evaluate(seq, x);
+            }
+
+          private:
+            // the index i of the segment [keys[i], keys[i+1]] that contains x, x has to be clamped already
+            std::size_t find_segment(x_base x) const {
+                const auto last_segment = keys.size() - 2;
+                if (uniform) {
+                    return std::min(static_cast<std::size_t>((x - keys.front()) * inv_step), last_segment);
+                }
+
+                // find the first key that is greater than x
+                std::size_t k = 1;
+                while (k < eytzinger_keys.size()) {
+                    k = 2 * k + static_cast<std::size_t>(eytzinger_keys[k] <= x);
+                }
+                k >>= std::countr_one(k) + 1;
+
+                const auto first_greater = k == 0 ? keys.size() : eytzinger_index[k];
+                return std::min(first_greater == 0 ? std::size_t{0} : first_greater - 1, last_segment);
+            }
+
+            y_base interpolate(std::size_t segment, x_base x) const {
+                const auto dx = static_cast<y_base>(x - keys[segment]);
+                if (mode == interpolation::linear) {
+                    return values[segment] + dx * slopes[segment];
+                }
+
+                const auto h  = static_cast<y_base>(keys[segment + 1] - keys[segment]);
+                const auto t  = dx / h;
+                const auto t2 = t * t;
+                const auto t3 = t2 * t;
+
+                const auto h00 = 2 * t3 - 3 * t2 + 1;
+                const auto h10 = t3 - 2 * t2 + t;
+                const auto h01 = -2 * t3 + 3 * t2;
+                const auto h11 = t3 - t2;
+                return h00 * values[segment] + h10 * h * slopes[segment] + h01 * values[segment + 1] + h11 * h * slopes[segment + 1];
+            }
+
+            void compute_slopes() {
+                const auto count = keys.size();
+                slopes.resize(count);
+                if (mode == interpolation::linear) {
+                    for (std::size_t i = 0; i + 1 < count; ++i) {
+                        slopes[i] = (values[i + 1] - values[i]) / static_cast<y_base>(keys[i + 1] - keys[i]);
+                    }
+                    slopes[count - 1] = 0;
+                    return;
+                }
+
+                slopes.front() = (values[1] - values[0]) / static_cast<y_base>(keys[1] - keys[0]);
+                slopes.back()  = (values[count - 1] - values[count - 2]) / static_cast<y_base>(keys[count - 1] - keys[count - 2]);
+                for (std::size_t i = 1; i + 1 < count; ++i) {
+                    slopes[i] = (values[i + 1] - values[i - 1]) / static_cast<y_base>(keys[i + 1] - keys[i - 1]);
+                }
+            }
+
+            void build_eytzinger() {
+                eytzinger_keys.resize(keys.size() + 1);
+                eytzinger_index.resize(keys.size() + 1);
+                fill_eytzinger(0, 1);
+            }
+
+            std::size_t fill_eytzinger(std::size_t sorted_index, std::size_t k) {
+                if (k < eytzinger_keys.size()) {
+                    sorted_index       = fill_eytzinger(sorted_index, 2 * k);
+                    eytzinger_keys[k]  = keys[sorted_index];
+                    eytzinger_index[k] = sorted_index;
+                    sorted_index       = fill_eytzinger(sorted_index + 1, 2 * k + 1);
+                }
+                return sorted_index;
+            }
+
+            void detect_uniform_grid() {
+                const auto count     = keys.size();
+                const auto range     = keys.back() - keys.front();
+                const auto step      = range / static_cast<x_base>(count - 1);
+                const auto tolerance = range * static_cast<x_base>(1e-9);
+                for (std::size_t i = 1; i + 1 < count; ++i) {
+                    if (std::abs(keys[i] - (keys.front() + static_cast<x_base>(i) * step)) > tolerance) {
+                        return;
+                    }
+                }
+                uniform  = true;
+                inv_step = 1 / step;
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "unit_system/energy.hpp"
+#include "unit_system/speed.hpp"
+#include "unit_system/momentum.hpp"
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+
+        template <std::floating_point base_type>
+        [[nodiscard]]
+        auto operator/(const energy_t<base_type>& val, const speed_t<base_type>& other) {
+            auto _v1 = val.convert_offset(0);
+            auto _v2 = other.convert_offset(0);
+            return sakurajin::unit_system::momentum_t<base_type>{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
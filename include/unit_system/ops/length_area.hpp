@@ -0,0 +1,29 @@
+#pragma once
+
+#include "unit_system/length.hpp"
+#include "unit_system/area.hpp"
+
+#include <cmath>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+
+        template <std::floating_point base_type>
+        [[nodiscard]]
+        auto operator/(const area_t<base_type>& val, const length_t<base_type>& other) {
+            auto _v1 = val.convert_offset(0);
+            auto _v2 = other.convert_offset(0);
+            return sakurajin::unit_system::length_t<base_type>{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+        }
+
+
+        template <std::floating_point base_type>
+        [[nodiscard]]
+        auto sqrt(const area_t<base_type>& val) {
+            return sakurajin::unit_system::length_t<base_type>{std::sqrt(val.val()), std::sqrt(val.mult()), val.off()};
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "unit_system/length.hpp"
+#include "unit_system/area.hpp"
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+
+        template <std::floating_point base_type>
+        [[nodiscard]]
+        auto operator*(const length_t<base_type>& val, const length_t<base_type>& other) {
+            auto _v1 = val.convert_offset(0);
+            auto _v2 = other.convert_offset(0);
+            return sakurajin::unit_system::area_t<base_type>{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+        }
+
+
+        template <std::floating_point base_type>
+        [[nodiscard]]
+        auto square(const length_t<base_type>& val) {
+            return val * val;
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // A small work-stealing thread pool for the bulk algorithms of the library.
+        //
+        // parallel_for hands out [0, count) as one range. Whoever runs a range larger than the grain size splits off the upper half
+        // into its own queue and keeps the lower half, idle workers steal the oldest (largest) ranges from the other queues.
+        // The calling thread works on the ranges as well until all of them are done, so a pool with 0 workers runs everything
+        // on the calling thread. Calls from inside a worker (nested parallel_for) use the queue of that worker.
+        // The function passed to parallel_for must not throw.
+        class thread_pool {
+            struct job {
+                std::atomic<std::size_t> remaining;
+                std::size_t              grain_size;
+
+                job(std::size_t count, std::size_t grain)
+                    : remaining{count},
+                      grain_size{grain} {}
+
+                virtual void run(std::size_t begin, std::size_t end) noexcept = 0;
+            };
+
+            template <class func_t>
+            struct bulk_job final : job {
+                func_t& func;
+
+                bulk_job(std::size_t count, std::size_t grain, func_t& function)
+                    : job{count, grain},
+                      func{function} {}
+
+                void run(std::size_t begin, std::size_t end) noexcept override { func(begin, end); }
+            };
+
+            struct task {
+                job*        owner;
+                std::size_t begin;
+                std::size_t end;
+            };
+
+            struct alignas(cache_line_size) task_queue {
+                std::mutex       mutex;
+                std::deque<task> tasks;
+            };
+
+            // one queue per worker and one for all threads outside the pool
+            std::vector<std::unique_ptr<task_queue>> queues;
+            std::atomic<std::size_t>                 queued{0};
+            std::mutex                               sleep_mutex;
+            std::condition_variable_any              wake;
+            // declared last so the workers are joined before the queues are destroyed
+            std::vector<std::jthread> workers;
+
+            inline static thread_local const thread_pool* current_pool  = nullptr;
+            inline static thread_local std::size_t        current_queue = 0;
+
+            std::size_t own_queue() const noexcept { return current_pool == this ? current_queue : queues.size() - 1; }
+
+            void push(std::size_t index, const task& work) {
+                {
+                    // counted before the task is visible, pop decrements under the same mutex and cannot wrap queued below 0
+                    const std::lock_guard lock{queues[index]->mutex};
+                    queued.fetch_add(1, std::memory_order_relaxed);
+                    try {
+                        queues[index]->tasks.push_back(work);
+                    } catch (...) {
+                        queued.fetch_sub(1, std::memory_order_relaxed);
+                        throw;
+                    }
+                }
+                {
+                    // the sleeping workers check queued while holding this mutex, so the notification cannot get lost
+                    const std::lock_guard lock{sleep_mutex};
+                }
+                wake.notify_one();
+            }
+
+            // the newest task of the own queue or the oldest task of another queue
+            bool pop(std::size_t index, task& work) {
+                for (std::size_t i = 0; i < queues.size(); ++i) {
+                    auto&                 queue = *queues[(index + i) % queues.size()];
+                    const std::lock_guard lock{queue.mutex};
+                    if (queue.tasks.empty()) {
+                        continue;
+                    }
+                    if (i == 0) {
+                        work = queue.tasks.back();
+                        queue.tasks.pop_back();
+                    } else {
+                        work = queue.tasks.front();
+                        queue.tasks.pop_front();
+                    }
+                    queued.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+                return false;
+            }
+
+            bool run_one(std::size_t index) {
+                task work{};
+                if (!pop(index, work)) {
+                    return false;
+                }
+                auto* owner = work.owner;
+                while (work.end - work.begin > owner->grain_size) {
+                    const auto middle = work.begin + (work.end - work.begin) / 2;
+                    push(index, task{owner, middle, work.end});
+                    work.end = middle;
+                }
+                owner->run(work.begin, work.end);
+                // the owner may return as soon as remaining is 0, nothing may touch it after this
+                owner->remaining.fetch_sub(work.end - work.begin, std::memory_order_acq_rel);
+                return true;
+            }
+
+            void work(std::stop_token stop, std::size_t index) {
+                current_pool  = this;
+                current_queue = index;
+                while (!stop.stop_requested()) {
+                    if (!run_one(index)) {
+                        std::unique_lock lock{sleep_mutex};
+                        wake.wait(lock, stop, [this] { return queued.load(std::memory_order_acquire) > 0; });
+                    }
+                }
+            }
+
+          public:
+            // one worker less than the hardware threads, the calling thread is the last one
+            static std::size_t default_worker_count() noexcept {
+                const auto hardware = std::thread::hardware_concurrency();
+                return hardware > 1 ? hardware - 1 : 0;
+            }
+
+            explicit thread_pool(std::size_t worker_count = default_worker_count()) {
+                queues.reserve(worker_count + 1);
+                for (std::size_t i = 0; i < worker_count + 1; ++i) {
+                    queues.push_back(std::make_unique<task_queue>());
+                }
+                workers.reserve(worker_count);
+                for (std::size_t i = 0; i < worker_count; ++i) {
+                    workers.emplace_back([this, i](std::stop_token stop) { work(stop, i); });
+                }
+            }
+
+            thread_pool(const thread_pool&)            = delete;
+            thread_pool& operator=(const thread_pool&) = delete;
+
+            [[nodiscard]]
+            std::size_t worker_count() const noexcept {
+                return workers.size();
+            }
+
+            // calls func(begin, end) for disjoint ranges that cover [0, count), no range is split below grain_size elements
+            template <class func_t>
+            void parallel_for(std::size_t count, std::size_t grain_size, func_t&& func) {
+                grain_size = std::max<std::size_t>(grain_size, 1);
+                if (count == 0) {
+                    return;
+                }
+                if (workers.empty() || count <= grain_size) {
+                    func(std::size_t{0}, count);
+                    return;
+                }
+
+                bulk_job<std::remove_reference_t<func_t>> job{count, grain_size, func};
+                const auto                                index = own_queue();
+                push(index, task{&job, 0, count});
+                while (job.remaining.load(std::memory_order_acquire) > 0) {
+                    if (!run_one(index)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        };
+
+        // the pool parallel_policy uses if it does not name one, created on first use
+        inline thread_pool& default_thread_pool() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        // runs the algorithms on the calling thread
+        struct sequenced_policy {};
+
+        // runs the algorithms on a thread_pool, ranges of grain_size elements are the smallest unit of work
+        struct parallel_policy {
+            static constexpr std::size_t default_grain_size = std::size_t{1} << 16;
+
+            thread_pool* pool       = nullptr; // nullptr uses default_thread_pool()
+            std::size_t  grain_size = default_grain_size;
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy  par{};
+
+        template <class policy_t>
+        concept execution_policy =
+            std::same_as<std::remove_cvref_t<policy_t>, sequenced_policy> || std::same_as<std::remove_cvref_t<policy_t>, parallel_policy>;
+
+        // calls func(begin, end) for disjoint ranges that cover [0, count)
+        template <execution_policy policy_t, class func_t>
+        void for_each_range(const policy_t& policy, std::size_t count, func_t&& func) {
+            if constexpr (std::same_as<std::remove_cvref_t<policy_t>, parallel_policy>) {
+                auto& pool = policy.pool != nullptr ? *policy.pool : default_thread_pool();
+                pool.parallel_for(count, policy.grain_size, std::forward<func_t>(func));
+            } else {
+                if (count > 0) {
+                    func(std::size_t{0}, count);
+                }
+            }
+        }
+
+        namespace detail {
+
+            // the policy for a loop whose items cover `elements` elements each (words of a bitmask, chunks),
+            // so the grain size still counts elements
+            template <execution_policy policy_t>
+            policy_t grain_per_item(const policy_t& policy, std::size_t elements) {
+                auto retval = policy;
+                if constexpr (std::same_as<std::remove_cvref_t<policy_t>, parallel_policy>) {
+                    retval.grain_size = std::max<std::size_t>(policy.grain_size / std::max<std::size_t>(elements, 1), 1);
+                }
+                return retval;
+            }
+
+            // the elements per chunk of algorithms that work on independent chunks, one chunk for everything with seq
+            template <execution_policy policy_t>
+            std::size_t chunk_size(const policy_t& policy, std::size_t count) {
+                if constexpr (std::same_as<std::remove_cvref_t<policy_t>, parallel_policy>) {
+                    return std::max<std::size_t>(policy.grain_size, 1);
+                } else {
+                    return std::max<std::size_t>(count, 1);
+                }
+            }
+
+        } // namespace detail
+
+        // out[i] = in[i] converted to the multiplier and offset of like
+        template <execution_policy policy_t, unit_range in_range, unit_range out_range>
+            requires std::same_as<std::ranges::range_value_t<in_range>, std::ranges::range_value_t<out_range>>
+        void convert(const policy_t& policy, const in_range& in, out_range&& out, const std::ranges::range_value_t<in_range>& like) {
+            std::span  in_values{in};
+            std::span  out_values{out};
+            const auto count = std::min(in_values.size(), out_values.size());
+            for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    out_values[i] = in_values[i].convert_like(like);
+                }
+            });
+        }
+
+        // out[i] = a[i] * b[i] with the operator* of the units, for example force * length -> energy
+        template <execution_policy policy_t, unit_range a_range, unit_range b_range, unit_range out_range>
+            requires requires(const std::ranges::range_value_t<a_range>& a, const std::ranges::range_value_t<b_range>& b) {
+                { a * b } -> std::same_as<std::ranges::range_value_t<out_range>>;
+            }
+        void multiply(const policy_t& policy, const a_range& a, const b_range& b, out_range&& out) {
+            std::span  a_values{a};
+            std::span  b_values{b};
+            std::span  out_values{out};
+            const auto count = std::min({a_values.size(), b_values.size(), out_values.size()});
+            for_each_range(policy, count, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    out_values[i] = a_values[i] * b_values[i];
+                }
+            });
+        }
+
+        // the sum of all values in base units.
+        // The partial sums always cover the same ranges of the grain size, so the result does not depend on the number of threads.
+        template <execution_policy policy_t, unit_range range_t>
+        [[nodiscard]]
+        std::ranges::range_value_t<range_t> reduce(const policy_t& policy, const range_t& values) {
+            using unit_t    = std::ranges::range_value_t<range_t>;
+            using base_type = unit_base_t<unit_t>;
+
+            std::span   in{values};
+            std::size_t grain = parallel_policy::default_grain_size;
+            if constexpr (std::same_as<std::remove_cvref_t<policy_t>, parallel_policy>) {
+                grain = std::max<std::size_t>(policy.grain_size, 1);
+            }
+            const auto             chunks = (in.size() + grain - 1) / grain;
+            std::vector<base_type> partial(chunks);
+
+            // every chunk is one element of the outer loop, so the chunks are the smallest unit of work
+            const auto chunk_policy = detail::grain_per_item(policy, grain);
+            for_each_range(chunk_policy, chunks, [&](std::size_t first, std::size_t last) {
+                for (std::size_t chunk = first; chunk < last; ++chunk) {
+                    const auto end = std::min(in.size(), (chunk + 1) * grain);
+                    base_type  sum = 0;
+                    for (std::size_t i = chunk * grain; i < end; ++i) {
+                        sum += base_value(in[i]);
+                    }
+                    partial[chunk] = sum;
+                }
+            });
+
+            base_type total = 0;
+            for (const auto sum : partial) {
+                total += sum;
+            }
+            return unit_t{total, 1, 0};
+        }
+
+        // values[i] = clamp(values[i], lower, upper) in place
+        template <execution_policy policy_t, unit_range range_t>
+        void clamp(const policy_t&                            policy,
+                   range_t&&                                  values,
+                   const std::ranges::range_value_t<range_t>& lower,
+                   const std::ranges::range_value_t<range_t>& upper) {
+            std::span values_span{values};
+            for_each_range(policy, values_span.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    values_span[i] = clamp(values_span[i], lower, upper);
+                }
+            });
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "unit_system/config.hpp"
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+
+        template <std::floating_point base_type>
+        class UNIT_SYSTEM_EXPORT_MACRO power_t {
+          private:
+            base_type value{static_cast<base_type>(0.0)};
+            base_type multiplier{static_cast<base_type>(1.0)};
+            base_type offset{static_cast<base_type>(0.0)};
+            base_type rel_error{static_cast<base_type>(0.000001)};
+
+          public:
+            power_t()                     = default;
+            power_t(const power_t& other) = default;
+
+            template <class value_t = base_type, class mult_t = base_type, class offset_t = base_type>
+                requires std::convertible_to<value_t, base_type> && std::convertible_to<mult_t, base_type> &&
+                             std::convertible_to<offset_t, base_type>
+            explicit power_t(value_t v, mult_t mult = 1.0, offset_t off = 0.0)
+                : value{static_cast<base_type>(v)},
+                  multiplier{static_cast<base_type>(mult)},
+                  offset{static_cast<base_type>(off)} {}
+
+            template <std::intmax_t numerator, std::intmax_t denumerator = 1, class value_t = base_type, class offset_t = base_type>
+            explicit power_t(value_t v, std::ratio<numerator, denumerator>, offset_t off = 0.0)
+                : power_t{v, static_cast<long double>(numerator) / static_cast<long double>(denumerator), off} {}
+
+
+            base_type val() const { return value; }
+            base_type mult() const { return multiplier; }
+            base_type off() const { return offset; }
+            base_type rel_err() const { return rel_error; }
+
+            base_type& val() { return value; }
+            base_type& mult() { return multiplier; }
+            base_type& off() { return offset; }
+            base_type& rel_err() { return rel_error; }
+
+
+            template <class scalar_t>
+                requires std::convertible_to<scalar_t, base_type>
+            power_t<base_type> operator*(scalar_t scalar) const {
+                return power_t<base_type>{value * static_cast<base_type>(scalar), multiplier, offset};
+            }
+
+            template <class scalar_t>
+                requires std::convertible_to<scalar_t, base_type>
+            void operator*=(scalar_t scalar) {
+                value *= static_cast<base_type>(scalar);
+            }
+
+            template <class scalar_t>
+                requires std::convertible_to<scalar_t, base_type>
+            power_t<base_type> operator/(scalar_t scalar) const {
+                return power_t<base_type>{value / static_cast<base_type>(scalar), multiplier, offset};
+            }
+            template <class scalar_t>
+                requires std::convertible_to<scalar_t, base_type>
+            void operator/=(scalar_t scalar) {
+                value /= static_cast<base_type>(scalar);
+            }
+
+
+            long double operator/(const power_t& other) const {
+                return static_cast<long double>(this->value) / static_cast<long double>(other.convert_like(*this).val());
+            }
+
+            power_t operator+(const power_t& other) const {
+                auto retval = other.convert_like(*this);
+                retval.val() += this->value;
+                return retval;
+            }
+            void operator+=(const power_t& other) {
+                auto retval = other.convert_like(*this);
+                this->value += retval.val();
+            }
+
+            power_t operator-(const power_t& other) const {
+                auto retval = this->convert_like(other);
+                retval.val() -= other.val();
+                return retval;
+            }
+            void operator-=(const power_t& other) {
+                auto retval = other.convert_like(*this);
+                this->value -= retval.val();
+            }
+
+            power_t operator-() const { return power_t{-value, multiplier, offset}; }
+
+            power_t& operator=(const power_t& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const power_t& other) { value = other.convert_like(*this).val(); }
+
+            explicit operator long double() const { return convert_copy(1.0, 0.0).val(); }
+
+            template <class mult_t = base_type, class offset_t = base_type>
+                requires std::convertible_to<mult_t, base_type> && std::convertible_to<offset_t, base_type>
+            [[nodiscard]]
+            power_t convert_copy(mult_t new_multiplier, offset_t new_offset) const {
+                auto new_mult = static_cast<base_type>(new_multiplier);
+                auto new_off  = static_cast<base_type>(new_offset);
+                auto new_val  = (value * multiplier + (offset - new_off)) / new_mult;
+                return power_t{new_val, new_mult, new_off};
+            }
+
+            template <class mult_t = base_type>
+                requires std::convertible_to<mult_t, base_type>
+            [[nodiscard]]
+            auto convert_multiplier(mult_t new_multiplier) const {
+                return convert_copy(new_multiplier, this->offset);
+            }
+
+            template <class offset_t = base_type>
+                requires std::convertible_to<offset_t, base_type>
+            [[nodiscard]]
+            auto convert_offset(offset_t new_offset) const {
+                return convert_copy(this->multiplier, new_offset);
+            }
+
+            // returns a copy of the unit with the same multiplier and offset as the other unit
+            [[nodiscard]]
+            auto convert_like(const power_t& other) const {
+                return convert_copy(other.mult(), other.off());
+            }
+
+            auto operator<=>(const power_t& other) const { return this->val() <=> other.convert_like(*this).val(); }
+
+            auto operator==(const power_t& other) const { return this->val() == other.convert_like(*this).val(); }
+            auto operator!=(const power_t& other) const { return this->val() != other.convert_like(*this).val(); }
+        };
+
+
+        template <std::floating_point base_type, class sclar_t>
+            requires std::convertible_to<sclar_t, base_type>
+        power_t<base_type> operator*(sclar_t scalar, const power_t<base_type>& value) {
+            return value * scalar;
+        }
+
+        template <std::floating_point base_type, class mult_t = base_type, class offset_t = base_type>
+            requires std::convertible_to<mult_t, base_type> && std::convertible_to<offset_t, base_type>
+        power_t<base_type> unit_cast(const power_t<base_type>& unit, mult_t new_multiplier = 1, offset_t new_offset = 0) {
+            return unit.convert_copy(new_multiplier, new_offset);
+        }
+
+        template <std::floating_point base_type>
+        power_t<base_type> clamp(const power_t<base_type>& unit, const power_t<base_type>& lower, const power_t<base_type>& upper) {
+            auto low  = lower.convert_like(unit);
+            auto high = upper.convert_like(unit);
+            const auto value = unit.val() < low.val() ? low.val() : (high.val() < unit.val() ? high.val() : unit.val());
+            return power_t<base_type>{value, unit.mult(), unit.off()};
+        }
+
+        template <std::floating_point base_type>
+        std::ostream& operator<<(std::ostream& os, const power_t<base_type>& val) {
+            auto val_raw = val.convert_copy(1.0, 0.0);
+            return os << val_raw.val() << " Watt";
+        }
+
+        typedef power_t<UNIT_SYSTEM_DEFAULT_TYPE> power;
+
+#ifdef UNIT_SYSTEM_EXTERN_TEMPLATES
+        // instantiated in the unit-system library
+        extern template class UNIT_SYSTEM_EXPORT_MACRO power_t<float>;
+        extern template class UNIT_SYSTEM_EXPORT_MACRO power_t<double>;
+        extern template class UNIT_SYSTEM_EXPORT_MACRO power_t<long double>;
+#endif
+
+        inline namespace literals {
+
+
+            inline auto operator"" _W(long double val) {
+                return sakurajin::unit_system::power{val, 1.0, 0.0};
+            }
+            inline auto operator"" _W(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1.0, 0.0};
+            }
+
+            inline auto operator"" _PW(long double val) {
+                return sakurajin::unit_system::power{val, 1000000000000000.0, 0.0};
+            }
+            inline auto operator"" _PW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1000000000000000.0, 0.0};
+            }
+
+            inline auto operator"" _TW(long double val) {
+                return sakurajin::unit_system::power{val, 1000000000000.0, 0.0};
+            }
+            inline auto operator"" _TW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1000000000000.0, 0.0};
+            }
+
+            inline auto operator"" _GW(long double val) {
+                return sakurajin::unit_system::power{val, 1000000000.0, 0.0};
+            }
+            inline auto operator"" _GW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1000000000.0, 0.0};
+            }
+
+            inline auto operator"" _MW(long double val) {
+                return sakurajin::unit_system::power{val, 1000000.0, 0.0};
+            }
+            inline auto operator"" _MW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1000000.0, 0.0};
+            }
+
+            inline auto operator"" _kW(long double val) {
+                return sakurajin::unit_system::power{val, 1000.0, 0.0};
+            }
+            inline auto operator"" _kW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1000.0, 0.0};
+            }
+
+            inline auto operator"" _mW(long double val) {
+                return sakurajin::unit_system::power{val, 0.001, 0.0};
+            }
+            inline auto operator"" _mW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 0.001, 0.0};
+            }
+
+            inline auto operator"" _uW(long double val) {
+                return sakurajin::unit_system::power{val, 1e-06, 0.0};
+            }
+            inline auto operator"" _uW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1e-06, 0.0};
+            }
+
+            inline auto operator"" _nW(long double val) {
+                return sakurajin::unit_system::power{val, 1e-09, 0.0};
+            }
+            inline auto operator"" _nW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1e-09, 0.0};
+            }
+
+            inline auto operator"" _pW(long double val) {
+                return sakurajin::unit_system::power{val, 1e-12, 0.0};
+            }
+            inline auto operator"" _pW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1e-12, 0.0};
+            }
+
+            inline auto operator"" _fW(long double val) {
+                return sakurajin::unit_system::power{val, 1e-15, 0.0};
+            }
+            inline auto operator"" _fW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1e-15, 0.0};
+            }
+
+            inline auto operator"" _aW(long double val) {
+                return sakurajin::unit_system::power{val, 1e-18, 0.0};
+            }
+            inline auto operator"" _aW(unsigned long long int val) {
+                return sakurajin::unit_system::power{static_cast<long double>(val), 1e-18, 0.0};
+            }
+
+        } // namespace literals
+    } // namespace unit_system
+} // namespace sakurajin
+
+
+namespace std {
+
+    template <std::floating_point base_type>
+    sakurajin::unit_system::power_t<base_type> abs(const sakurajin::unit_system::power_t<base_type>& unit) {
+        const auto raw_val = unit.val();
+        const auto inv_val = -raw_val;
+        const auto abs_val = (raw_val > inv_val) ? raw_val : inv_val;
+        return sakurajin::unit_system::power_t<base_type>{abs_val, unit.mult(), unit.off()};
+    }
+} // namespace std
@@ -0,0 +1,485 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/parallel.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // A column of values that all share one multiplier and offset (structure of arrays).
+        //
+        // Arithmetic between quantity_vectors, single units and scalars builds a lazy array expression.
+        // Assigning it evaluates the whole formula in one loop without intermediate vectors:
+        //
+        //     quantity_vector<energy> E = 0.5 * m * v * v;
+        //
+        // Since the multiplier and offset are the same for every element, they are combined once per expression
+        // and the loop only contains the raw multiplications, which the compiler can vectorize.
+        // The result unit of each step is the one of the normal operators, so only defined combinations compile.
+        //
+        // Expressions copy scalars and single units, but only keep a pointer to the values of the vectors they are built from.
+        // Those vectors have to outlive the expression and must not be resized or reassigned before it is evaluated.
+        template <unit_type unit_t>
+        class quantity_vector;
+
+        namespace detail {
+
+            template <class T>
+            inline constexpr bool is_quantity_vector = false;
+
+            template <class unit_t>
+            inline constexpr bool is_quantity_vector<quantity_vector<unit_t>> = true;
+
+            // the number of elements evaluated at once, each chunk is processed by a single thread
+            inline constexpr std::size_t array_chunk_size = 4096;
+
+        } // namespace detail
+
+        // the interface every node of an array expression provides:
+        // a raw value per element that is scaled by one multiplier and offset for the whole array
+        template <class expr_t>
+        concept array_expression = requires(const expr_t& expr, std::size_t index) {
+            typename expr_t::unit_type;
+            typename expr_t::base_type;
+            { expr_t::is_broadcast } -> std::convertible_to<bool>;
+            { expr.size() } -> std::same_as<std::size_t>;
+            { expr.multiplier() } -> std::same_as<typename expr_t::base_type>;
+            { expr.offset() } -> std::same_as<typename expr_t::base_type>;
+            { expr[index] } -> std::same_as<typename expr_t::base_type>;
+        };
+
+        template <class expr_t, class unit_t>
+        concept array_expression_of = array_expression<expr_t> && std::same_as<typename expr_t::unit_type, unit_t>;
+
+        // the values of a quantity_vector
+        template <unit_type unit_t>
+        class array_leaf {
+            using base = unit_base_t<unit_t>;
+
+            const base* values;
+            std::size_t count;
+            base        mult;
+            base        off;
+
+          public:
+            using unit_type                     = unit_t;
+            using base_type                     = base;
+            static constexpr bool is_broadcast = false;
+
+            explicit array_leaf(const quantity_vector<unit_t>& vec)
+                : values{vec.values().data()},
+                  count{vec.size()},
+                  mult{vec.mult()},
+                  off{vec.off()} {}
+
+            std::size_t size() const { return count; }
+            base_type   multiplier() const { return mult; }
+            base_type   offset() const { return off; }
+            base_type   operator[](std::size_t index) const { return values[index]; }
+        };
+
+        namespace detail {
+
+            template <class value_t>
+            struct broadcast_base {
+                using type = value_t;
+            };
+
+            template <unit_type value_t>
+            struct broadcast_base<value_t> {
+                using type = unit_base_t<value_t>;
+            };
+
+        } // namespace detail
+
+        // a single unit or scalar that is used for every element
+        template <class value_t>
+        class array_broadcast {
+            using base = typename detail::broadcast_base<value_t>::type;
+
+            base value;
+            base mult;
+            base off;
+
+          public:
+            using unit_type                     = value_t;
+            using base_type                     = base;
+            static constexpr bool is_broadcast = true;
+
+            explicit array_broadcast(const value_t& val)
+                requires std::floating_point<value_t>
+                : value{val},
+                  mult{1},
+                  off{0} {}
+
+            explicit array_broadcast(const value_t& val)
+                requires sakurajin::unit_system::unit_type<value_t>
+                : value{val.val()},
+                  mult{val.mult()},
+                  off{val.off()} {}
+
+            std::size_t size() const { return 0; }
+            base_type   multiplier() const { return mult; }
+            base_type   offset() const { return off; }
+            base_type   operator[](std::size_t) const { return value; }
+        };
+
+        namespace detail {
+
+            template <array_expression lhs_t, array_expression rhs_t>
+            std::size_t array_size(const lhs_t& lhs, const rhs_t& rhs) {
+                if constexpr (lhs_t::is_broadcast) {
+                    return rhs.size();
+                } else if constexpr (rhs_t::is_broadcast) {
+                    return lhs.size();
+                } else {
+                    if (lhs.size() != rhs.size()) {
+                        throw std::invalid_argument("array expressions need operands of the same size");
+                    }
+                    return lhs.size();
+                }
+            }
+
+            // scalars are cast to the base type of the unit they are combined with, like in the normal operators
+            template <array_expression lhs_t, array_expression rhs_t>
+            using array_base_t = std::conditional_t<
+                std::floating_point<typename rhs_t::unit_type> && !std::floating_point<typename lhs_t::unit_type>,
+                typename lhs_t::base_type,
+                std::conditional_t<std::floating_point<typename lhs_t::unit_type> && !std::floating_point<typename rhs_t::unit_type>,
+                                   typename rhs_t::base_type,
+                                   std::common_type_t<typename lhs_t::base_type, typename rhs_t::base_type>>>;
+
+        } // namespace detail
+
+        template <array_expression lhs_t, array_expression rhs_t>
+        class array_product {
+            using base = detail::array_base_t<lhs_t, rhs_t>;
+
+            lhs_t       lhs;
+            rhs_t       rhs;
+            std::size_t count;
+            base        mult;
+            base        off;
+            // the offset of each side in its own multiplier, added to remove the offset like convert_offset(0)
+            base lhs_shift{0};
+            base rhs_shift{0};
+
+            static constexpr bool lhs_scalar = std::floating_point<typename lhs_t::unit_type>;
+            static constexpr bool rhs_scalar = std::floating_point<typename rhs_t::unit_type>;
+
+          public:
+            using unit_type                     = decltype(std::declval<typename lhs_t::unit_type>() * std::declval<typename rhs_t::unit_type>());
+            using base_type                     = base;
+            static constexpr bool is_broadcast = lhs_t::is_broadcast && rhs_t::is_broadcast;
+
+            array_product(const lhs_t& left, const rhs_t& right)
+                : lhs{left},
+                  rhs{right},
+                  count{detail::array_size(left, right)} {
+                if constexpr (rhs_scalar) {
+                    // unit * scalar keeps the offset of the unit
+                    mult = static_cast<base>(lhs.multiplier());
+                    off  = static_cast<base>(lhs.offset());
+                } else if constexpr (lhs_scalar) {
+                    mult = static_cast<base>(rhs.multiplier());
+                    off  = static_cast<base>(rhs.offset());
+                } else {
+                    mult      = static_cast<base>(lhs.multiplier() * rhs.multiplier());
+                    off       = 0;
+                    lhs_shift = static_cast<base>(lhs.offset() / lhs.multiplier());
+                    rhs_shift = static_cast<base>(rhs.offset() / rhs.multiplier());
+                }
+            }
+
+            std::size_t size() const { return count; }
+            base_type   multiplier() const { return mult; }
+            base_type   offset() const { return off; }
+
+            base_type operator[](std::size_t index) const {
+                if constexpr (rhs_scalar) {
+                    return static_cast<base>(lhs[index] * rhs[index] * rhs.multiplier());
+                } else if constexpr (lhs_scalar) {
+                    return static_cast<base>(lhs[index] * lhs.multiplier() * rhs[index]);
+                } else {
+                    return static_cast<base>((lhs[index] + lhs_shift) * (rhs[index] + rhs_shift));
+                }
+            }
+        };
+
+        template <array_expression lhs_t, array_expression rhs_t>
+        class array_quotient {
+            using base = detail::array_base_t<lhs_t, rhs_t>;
+
+            lhs_t       lhs;
+            rhs_t       rhs;
+            std::size_t count;
+            base        mult;
+            base        off;
+            base        lhs_shift{0};
+            base        rhs_shift{0};
+            // converts rhs into the multiplier and offset of lhs for ratios of the same unit
+            base rhs_scale{1};
+
+            static constexpr bool rhs_scalar = std::floating_point<typename rhs_t::unit_type>;
+            static constexpr bool same_unit  = std::same_as<typename lhs_t::unit_type, typename rhs_t::unit_type>;
+
+          public:
+            using unit_type                     = decltype(std::declval<typename lhs_t::unit_type>() / std::declval<typename rhs_t::unit_type>());
+            using base_type                     = base;
+            static constexpr bool is_broadcast = lhs_t::is_broadcast && rhs_t::is_broadcast;
+
+            array_quotient(const lhs_t& left, const rhs_t& right)
+                : lhs{left},
+                  rhs{right},
+                  count{detail::array_size(left, right)} {
+                if constexpr (rhs_scalar) {
+                    // unit / scalar keeps the offset of the unit
+                    mult = static_cast<base>(lhs.multiplier());
+                    off  = static_cast<base>(lhs.offset());
+                } else if constexpr (same_unit) {
+                    // the ratio of two values of the same unit, rhs is converted like lhs as in operator/
+                    mult      = 1;
+                    off       = 0;
+                    rhs_scale = static_cast<base>(rhs.multiplier() / lhs.multiplier());
+                    rhs_shift = static_cast<base>((rhs.offset() - lhs.offset()) / lhs.multiplier());
+                } else {
+                    mult      = static_cast<base>(lhs.multiplier() / rhs.multiplier());
+                    off       = 0;
+                    lhs_shift = static_cast<base>(lhs.offset() / lhs.multiplier());
+                    rhs_shift = static_cast<base>(rhs.offset() / rhs.multiplier());
+                }
+            }
+
+            std::size_t size() const { return count; }
+            base_type   multiplier() const { return mult; }
+            base_type   offset() const { return off; }
+
+            base_type operator[](std::size_t index) const {
+                if constexpr (rhs_scalar) {
+                    return static_cast<base>(lhs[index] / (rhs[index] * rhs.multiplier()));
+                } else if constexpr (same_unit) {
+                    return static_cast<base>(lhs[index] / (rhs[index] * rhs_scale + rhs_shift));
+                } else {
+                    return static_cast<base>((lhs[index] + lhs_shift) / (rhs[index] + rhs_shift));
+                }
+            }
+        };
+
+        namespace detail {
+
+            template <class operand_t>
+            auto as_array(const operand_t& operand) {
+                if constexpr (array_expression<operand_t>) {
+                    return operand;
+                } else if constexpr (is_quantity_vector<operand_t>) {
+                    return array_leaf<typename operand_t::unit_type>{operand};
+                } else if constexpr (unit_type<operand_t> || std::floating_point<operand_t>) {
+                    return array_broadcast<operand_t>{operand};
+                } else {
+                    return array_broadcast<double>{static_cast<double>(operand)};
+                }
+            }
+
+            template <class operand_t>
+            concept array_operand = array_expression<operand_t> || is_quantity_vector<operand_t> || unit_type<operand_t> ||
+                                    std::is_arithmetic_v<operand_t>;
+
+            template <class operand_t>
+            concept array_valued = array_expression<operand_t> || is_quantity_vector<operand_t>;
+
+            template <class lhs_t, class rhs_t>
+            concept array_operands = array_operand<lhs_t> && array_operand<rhs_t> && (array_valued<lhs_t> || array_valued<rhs_t>);
+
+            // out[i] = expr[i] * scale + shift for i in [begin, end), the whole expression is inlined into this loop
+            template <array_expression expr_t, std::floating_point base_type>
+            void evaluate_range(const expr_t& expr, base_type* out, std::size_t begin, std::size_t end, base_type scale, base_type shift) {
+                if (scale == 1 && shift == 0) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        out[i] = static_cast<base_type>(expr[i]);
+                    }
+                } else {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        out[i] = static_cast<base_type>(expr[i]) * scale + shift;
+                    }
+                }
+            }
+
+            // evaluates the expression chunk by chunk, the chunks are distributed with the execution policy
+            template <array_expression expr_t, std::floating_point base_type, execution_policy policy_t>
+            void evaluate_chunked(const expr_t& expr, std::span<base_type> out, base_type scale, base_type shift, const policy_t& policy) {
+                const auto count  = out.size();
+                const auto chunks = (count + array_chunk_size - 1) / array_chunk_size;
+
+                const auto chunk_policy = grain_per_item(policy, array_chunk_size);
+                for_each_range(chunk_policy, chunks, [&](std::size_t first_chunk, std::size_t last_chunk) {
+                    for (std::size_t chunk = first_chunk; chunk < last_chunk; ++chunk) {
+                        const auto begin = chunk * array_chunk_size;
+                        evaluate_range(expr, out.data(), begin, std::min(begin + array_chunk_size, count), scale, shift);
+                    }
+                });
+            }
+
+        } // namespace detail
+
+        template <class lhs_t, class rhs_t>
+            requires detail::array_operands<lhs_t, rhs_t>
+        auto operator*(const lhs_t& lhs, const rhs_t& rhs) -> array_product<decltype(detail::as_array(lhs)), decltype(detail::as_array(rhs))> {
+            return {detail::as_array(lhs), detail::as_array(rhs)};
+        }
+
+        template <class lhs_t, class rhs_t>
+            requires detail::array_operands<lhs_t, rhs_t>
+        auto operator/(const lhs_t& lhs, const rhs_t& rhs) -> array_quotient<decltype(detail::as_array(lhs)), decltype(detail::as_array(rhs))> {
+            return {detail::as_array(lhs), detail::as_array(rhs)};
+        }
+
+        template <unit_type unit_t>
+        class quantity_vector {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+          private:
+            std::vector<base_type> data;
+            base_type              multiplier{1};
+            base_type              offset{0};
+
+          public:
+            quantity_vector() = default;
+
+            // count zeros in the base unit
+            explicit quantity_vector(std::size_t count)
+                : data(count) {}
+
+            // count copies of value, the vector uses the multiplier and offset of value
+            quantity_vector(std::size_t count, const unit_t& value)
+                : data(count, value.val()),
+                  multiplier{value.mult()},
+                  offset{value.off()} {}
+
+            // all units are converted to the multiplier and offset of the first one
+            explicit quantity_vector(std::span<const unit_t> units) {
+                if (!units.empty()) {
+                    multiplier = units.front().mult();
+                    offset     = units.front().off();
+                }
+                data.reserve(units.size());
+                for (const auto& unit : units) {
+                    data.push_back(unit.convert_copy(multiplier, offset).val());
+                }
+            }
+
+            explicit quantity_vector(const std::vector<unit_t>& units)
+                : quantity_vector{std::span<const unit_t>{units}} {}
+
+            // evaluates an expression, the vector gets the multiplier and offset of the expression
+            template <class expr_t>
+                requires array_expression_of<expr_t, unit_t>
+            quantity_vector(const expr_t& expr)
+                : quantity_vector{expr, seq} {}
+
+            // evaluates an expression with an execution policy, e.g. parallel_policy{&pool}
+            template <class expr_t, execution_policy policy_t>
+                requires array_expression_of<expr_t, unit_t>
+            quantity_vector(const expr_t& expr, const policy_t& policy)
+                : data(expr.size()),
+                  multiplier{static_cast<base_type>(expr.multiplier())},
+                  offset{static_cast<base_type>(expr.offset())} {
+                detail::evaluate_chunked(expr, std::span<base_type>{data}, base_type{1}, base_type{0}, policy);
+            }
+
+            // evaluates an expression into the multiplier and offset this vector already has
+            template <class expr_t>
+                requires array_expression_of<expr_t, unit_t>
+            quantity_vector& operator=(const expr_t& expr) {
+                assign(expr, seq);
+                return *this;
+            }
+
+            // like operator= but the evaluation runs with an execution policy, e.g. parallel_policy{&pool}
+            template <class expr_t, execution_policy policy_t>
+                requires array_expression_of<expr_t, unit_t>
+            void assign(const expr_t& expr, const policy_t& policy) {
+                const auto scale = static_cast<base_type>(expr.multiplier() / multiplier);
+                const auto shift = static_cast<base_type>((expr.offset() - offset) / multiplier);
+
+                // the expression might read from this vector, so it is only resized if the size changes
+                if (data.size() != expr.size()) {
+                    std::vector<base_type> result(expr.size());
+                    detail::evaluate_chunked(expr, std::span<base_type>{result}, scale, shift, policy);
+                    data = std::move(result);
+                    return;
+                }
+                detail::evaluate_chunked(expr, std::span<base_type>{data}, scale, shift, policy);
+            }
+
+            [[nodiscard]]
+            std::size_t size() const {
+                return data.size();
+            }
+
+            [[nodiscard]]
+            bool empty() const {
+                return data.empty();
+            }
+
+            [[nodiscard]]
+            base_type mult() const {
+                return multiplier;
+            }
+
+            [[nodiscard]]
+            base_type off() const {
+                return offset;
+            }
+
+            // the raw values in the multiplier and offset of this vector
+            std::span<base_type> values() { return data; }
+
+            std::span<const base_type> values() const { return data; }
+
+            [[nodiscard]]
+            unit_t operator[](std::size_t index) const {
+                return unit_t{data[index], multiplier, offset};
+            }
+
+            void set(std::size_t index, const unit_t& value) { data[index] = value.convert_copy(multiplier, offset).val(); }
+
+            void push_back(const unit_t& value) { data.push_back(value.convert_copy(multiplier, offset).val()); }
+
+            void reserve(std::size_t count) { data.reserve(count); }
+
+            // changes the multiplier and offset of every element
+            void convert(base_type new_multiplier, base_type new_offset) {
+                const auto scale = multiplier / new_multiplier;
+                const auto shift = (offset - new_offset) / new_multiplier;
+                for (auto& value : data) {
+                    value = value * scale + shift;
+                }
+                multiplier = new_multiplier;
+                offset     = new_offset;
+            }
+
+            [[nodiscard]]
+            std::vector<unit_t> to_vector() const {
+                std::vector<unit_t> retval;
+                retval.reserve(data.size());
+                for (const auto value : data) {
+                    retval.emplace_back(value, multiplier, offset);
+                }
+                return retval;
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
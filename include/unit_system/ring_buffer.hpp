@@ -0,0 +1,289 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        namespace detail {
+
+            // the multiplier and offset all values of a queue share, units are converted to them when they are pushed
+            template <unit_type unit_t>
+            class queue_units {
+              public:
+                using unit_type = unit_t;
+                using base_type = unit_base_t<unit_t>;
+
+              protected:
+                unit_t like;
+
+                explicit queue_units(const unit_t& like_unit)
+                    : like{like_unit} {}
+
+                base_type to_value(const unit_t& unit) const noexcept { return unit.convert_like(like).val(); }
+                unit_t    from_value(base_type value) const noexcept { return unit_t{value, like.mult(), like.off()}; }
+
+              public:
+                [[nodiscard]]
+                base_type mult() const noexcept {
+                    return like.mult();
+                }
+
+                [[nodiscard]]
+                base_type off() const noexcept {
+                    return like.off();
+                }
+            };
+
+            // the capacity of a ring buffer, rounded up to a power of two so the index is a mask
+            inline std::size_t ring_capacity(std::size_t capacity) {
+                return std::bit_ceil(std::max<std::size_t>(capacity, 2));
+            }
+
+        } // namespace detail
+
+        // A bounded lock-free queue for one producer and one consumer thread, e.g. from an acquisition to a processing thread.
+        //
+        // Only the raw values are stored, all of them use the multiplier and offset of the unit passed to the constructor.
+        // push converts the units to them and pop returns units with them, push_values and pop_values skip the conversion.
+        // The batch versions move as many values as fit and publish them with a single atomic store.
+        // The buffer is allocated in the constructor, push and pop never allocate or block.
+        template <unit_type unit_t>
+        class spsc_queue : public detail::queue_units<unit_t> {
+            using units = detail::queue_units<unit_t>;
+
+          public:
+            using typename units::base_type;
+
+          private:
+            std::size_t                  capacity_;
+            std::size_t                  mask;
+            std::unique_ptr<base_type[]> buffer;
+
+            // written by the producer, the read index is a cached copy of head
+            alignas(cache_line_size) std::atomic<std::size_t> tail{0};
+            std::size_t cached_head = 0;
+
+            // written by the consumer, the write index is a cached copy of tail
+            alignas(cache_line_size) std::atomic<std::size_t> head{0};
+            std::size_t cached_tail = 0;
+
+            template <class func_t>
+            std::size_t push_n(std::size_t count, func_t&& value_at) noexcept {
+                const auto pos = tail.load(std::memory_order_relaxed);
+                if (capacity_ - (pos - cached_head) < count) {
+                    cached_head = head.load(std::memory_order_acquire);
+                }
+                count = std::min(count, capacity_ - (pos - cached_head));
+                for (std::size_t i = 0; i < count; ++i) {
+                    buffer[(pos + i) & mask] = value_at(i);
+                }
+                tail.store(pos + count, std::memory_order_release);
+                return count;
+            }
+
+            template <class func_t>
+            std::size_t pop_n(std::size_t count, func_t&& store_at) noexcept {
+                const auto pos = head.load(std::memory_order_relaxed);
+                if (cached_tail - pos < count) {
+                    cached_tail = tail.load(std::memory_order_acquire);
+                }
+                count = std::min(count, cached_tail - pos);
+                for (std::size_t i = 0; i < count; ++i) {
+                    store_at(i, buffer[(pos + i) & mask]);
+                }
+                head.store(pos + count, std::memory_order_release);
+                return count;
+            }
+
+          public:
+            // a queue for at least capacity values in the multiplier and offset of like
+            explicit spsc_queue(std::size_t capacity, const unit_t& like = unit_t{0, 1, 0})
+                : units{like},
+                  capacity_{detail::ring_capacity(capacity)},
+                  mask{capacity_ - 1},
+                  buffer{std::make_unique<base_type[]>(capacity_)} {}
+
+            spsc_queue(const spsc_queue&)            = delete;
+            spsc_queue& operator=(const spsc_queue&) = delete;
+
+            [[nodiscard]]
+            std::size_t capacity() const noexcept {
+                return capacity_;
+            }
+
+            // the number of queued values, only exact if neither thread is using the queue
+            [[nodiscard]]
+            std::size_t size() const noexcept {
+                return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+            }
+
+            // producer: returns false if the queue is full
+            bool push(const unit_t& unit) noexcept {
+                const auto value = this->to_value(unit);
+                return push_n(1, [value](std::size_t) { return value; }) == 1;
+            }
+
+            // producer: pushes as many units as fit and returns how many that were
+            std::size_t push(std::span<const unit_t> units_in) noexcept {
+                return push_n(units_in.size(), [this, units_in](std::size_t i) { return this->to_value(units_in[i]); });
+            }
+
+            // producer: pushes values that already use the multiplier and offset of the queue
+            std::size_t push_values(std::span<const base_type> values) noexcept {
+                return push_n(values.size(), [values](std::size_t i) { return values[i]; });
+            }
+
+            // consumer: returns nothing if the queue is empty
+            std::optional<unit_t> pop() noexcept {
+                base_type value{};
+                if (pop_n(1, [&value](std::size_t, base_type v) { value = v; }) == 0) {
+                    return std::nullopt;
+                }
+                return this->from_value(value);
+            }
+
+            // consumer: pops up to out.size() units and returns how many that were
+            std::size_t pop(std::span<unit_t> out) noexcept {
+                return pop_n(out.size(), [this, out](std::size_t i, base_type v) { out[i] = this->from_value(v); });
+            }
+
+            // consumer: pops raw values in the multiplier and offset of the queue
+            std::size_t pop_values(std::span<base_type> out) noexcept {
+                return pop_n(out.size(), [out](std::size_t i, base_type v) { out[i] = v; });
+            }
+        };
+
+        // A bounded lock-free queue for several producer threads and one consumer thread.
+        //
+        // It has the same interface as spsc_queue. Producers reserve a range of slots with a compare exchange on the write index
+        // and mark every slot as written with a sequence number, so a slow producer only delays the values after its own.
+        // A slot is free again once the read index has passed it, the consumer moves the read index only after reading the values.
+        // A batch push reserves all slots at once, the values of one batch stay in order and are not mixed with other producers.
+        template <unit_type unit_t>
+        class mpsc_queue : public detail::queue_units<unit_t> {
+            using units = detail::queue_units<unit_t>;
+
+          public:
+            using typename units::base_type;
+
+          private:
+            struct slot {
+                // pos + 1 once the value for pos is written, positions of earlier rounds never match
+                std::atomic<std::size_t> sequence;
+                base_type                value;
+            };
+
+            std::size_t             capacity_;
+            std::size_t             mask;
+            std::unique_ptr<slot[]> slots;
+
+            alignas(cache_line_size) std::atomic<std::size_t> tail{0};
+            alignas(cache_line_size) std::atomic<std::size_t> head{0};
+
+            template <class func_t>
+            std::size_t push_n(std::size_t count, func_t&& value_at) noexcept {
+                auto pos = tail.load(std::memory_order_relaxed);
+                while (true) {
+                    const auto free = capacity_ - (pos - head.load(std::memory_order_acquire));
+                    const auto n    = std::min(count, free);
+                    if (n == 0) {
+                        return 0;
+                    }
+                    if (tail.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed, std::memory_order_relaxed)) {
+                        count = n;
+                        break;
+                    }
+                }
+                for (std::size_t i = 0; i < count; ++i) {
+                    auto& cell = slots[(pos + i) & mask];
+                    cell.value = value_at(i);
+                    cell.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return count;
+            }
+
+            template <class func_t>
+            std::size_t pop_n(std::size_t count, func_t&& store_at) noexcept {
+                const auto pos = head.load(std::memory_order_relaxed);
+                std::size_t i  = 0;
+                for (; i < count; ++i) {
+                    auto& cell = slots[(pos + i) & mask];
+                    if (cell.sequence.load(std::memory_order_acquire) != pos + i + 1) {
+                        break;
+                    }
+                    store_at(i, cell.value);
+                }
+                head.store(pos + i, std::memory_order_release);
+                return i;
+            }
+
+          public:
+            // a queue for at least capacity values in the multiplier and offset of like
+            explicit mpsc_queue(std::size_t capacity, const unit_t& like = unit_t{0, 1, 0})
+                : units{like},
+                  capacity_{detail::ring_capacity(capacity)},
+                  mask{capacity_ - 1},
+                  slots{std::make_unique<slot[]>(capacity_)} {}
+
+            mpsc_queue(const mpsc_queue&)            = delete;
+            mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+            [[nodiscard]]
+            std::size_t capacity() const noexcept {
+                return capacity_;
+            }
+
+            // the number of reserved slots, only exact if no thread is using the queue
+            [[nodiscard]]
+            std::size_t size() const noexcept {
+                return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+            }
+
+            // producer: returns false if the queue is full
+            bool push(const unit_t& unit) noexcept {
+                const auto value = this->to_value(unit);
+                return push_n(1, [value](std::size_t) { return value; }) == 1;
+            }
+
+            // producer: pushes as many units as fit and returns how many that were
+            std::size_t push(std::span<const unit_t> units_in) noexcept {
+                return push_n(units_in.size(), [this, units_in](std::size_t i) { return this->to_value(units_in[i]); });
+            }
+
+            // producer: pushes values that already use the multiplier and offset of the queue
+            std::size_t push_values(std::span<const base_type> values) noexcept {
+                return push_n(values.size(), [values](std::size_t i) { return values[i]; });
+            }
+
+            // consumer: returns nothing if the queue is empty or the next value is not written yet
+            std::optional<unit_t> pop() noexcept {
+                base_type value{};
+                if (pop_n(1, [&value](std::size_t, base_type v) { value = v; }) == 0) {
+                    return std::nullopt;
+                }
+                return this->from_value(value);
+            }
+
+            // consumer: pops up to out.size() units and returns how many that were
+            std::size_t pop(std::span<unit_t> out) noexcept {
+                return pop_n(out.size(), [this, out](std::size_t i, base_type v) { out[i] = this->from_value(v); });
+            }
+
+            // consumer: pops raw values in the multiplier and offset of the queue
+            std::size_t pop_values(std::span<base_type> out) noexcept {
+                return pop_n(out.size(), [out](std::size_t i, base_type v) { out[i] = v; });
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
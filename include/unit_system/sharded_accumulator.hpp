@@ -0,0 +1,232 @@
+#pragma once
+
+#include "unit_system/atomic_quantity.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // how the shards of a sharded_accumulator add up their values
+        enum class summation {
+            plain,       // one addition per value
+            compensated, // Kahan summation, keeps the low bits that a plain addition loses when the total is much larger than the values
+        };
+
+        namespace detail {
+
+            // The numbers of the running threads. A thread returns its number when it ends and the next new thread gets the
+            // smallest free number, so the numbers stay small and a new thread takes over the shards of an ended one.
+            // The mutex orders the adds of the ended thread before the adds of the new owner.
+            class thread_numbers {
+                std::mutex               mutex;
+                std::vector<std::size_t> free;
+                std::size_t              next = 1;
+
+              public:
+                std::size_t acquire() {
+                    const std::lock_guard lock{mutex};
+                    if (free.empty()) {
+                        return next++;
+                    }
+                    const auto smallest = std::min_element(free.begin(), free.end());
+                    const auto number   = *smallest;
+                    *smallest           = free.back();
+                    free.pop_back();
+                    return number;
+                }
+
+                void release(std::size_t number) {
+                    const std::lock_guard lock{mutex};
+                    free.push_back(number);
+                }
+
+                // never destroyed, threads can still end while the static objects are destroyed
+                static thread_numbers& instance() {
+                    static auto* numbers = new thread_numbers;
+                    return *numbers;
+                }
+            };
+
+            // the number of the calling thread, starting at 1
+            inline std::size_t thread_number() {
+                struct holder {
+                    std::size_t number = thread_numbers::instance().acquire();
+
+                    ~holder() { thread_numbers::instance().release(number); }
+                };
+                thread_local const holder own;
+                return own.number;
+            }
+
+        } // namespace detail
+
+        // A total that many threads add to, e.g. the energy or time spent on all requests of a server.
+        //
+        // Every shard is a cache line of its own and belongs to the first thread that adds to it. add(unit) picks the shard
+        // of the calling thread (thread number modulo shard count), add(index, unit) a given shard, e.g. the index of a worker.
+        // The running threads have the numbers 1, 2, ..., so with at least as many shards as threads every thread has its own.
+        // The owner adds with a relaxed load and store (no read-modify-write), so its adds are wait-free.
+        // Other threads that add to an owned shard, e.g. because there are more threads than shards, use a lock-free fetch_add
+        // on a second total of the shard, so no add is lost. When the owner ends, the next new thread with its number owns the shard.
+        // load merges all shards into one unit in base units and can run at any time, while adds are running
+        // it returns a value between the totals before and after the concurrent adds.
+        // With summation::compensated the owner publishes the sum and its correction as a pair (a seqlock per shard),
+        // the adds of other threads are not compensated.
+        template <lock_free_unit unit_t, summation mode = summation::plain>
+        class sharded_accumulator {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+          private:
+            struct alignas(cache_line_size) shard {
+                // the thread_number of the owner, 0 while the shard is free
+                std::atomic<std::size_t> owner{0};
+                std::atomic<base_type>   sum{0};
+                // the low bits lost by the last additions, only used with summation::compensated
+                std::atomic<base_type> compensation{0};
+                // odd while the owner changes sum and compensation, only used with summation::compensated
+                std::atomic<std::uint64_t> sequence{0};
+                // the adds of all other threads
+                std::atomic<base_type> shared{0};
+            };
+
+            std::size_t              count;
+            std::unique_ptr<shard[]> shards;
+
+            // adds value to sum and compensation with Kahan summation
+            static void compensated_add(base_type& sum, base_type& compensation, base_type value) noexcept {
+                const auto corrected = value - compensation;
+                const auto next      = sum + corrected;
+                compensation         = (next - sum) - corrected;
+                sum                  = next;
+            }
+
+            // true if the calling thread owns slot, a free shard is claimed
+            static bool owns(shard& slot) noexcept {
+                const auto  self  = detail::thread_number();
+                std::size_t owner = slot.owner.load(std::memory_order_relaxed);
+                if (owner == 0) {
+                    slot.owner.compare_exchange_strong(owner, self, std::memory_order_relaxed);
+                    return owner == 0 || owner == self;
+                }
+                return owner == self;
+            }
+
+            static void add_to(shard& slot, base_type value) noexcept {
+                if (!owns(slot)) {
+                    slot.shared.fetch_add(value, std::memory_order_relaxed);
+                    return;
+                }
+                if constexpr (mode == summation::compensated) {
+                    const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+                    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_release);
+
+                    auto sum          = slot.sum.load(std::memory_order_relaxed);
+                    auto compensation = slot.compensation.load(std::memory_order_relaxed);
+                    compensated_add(sum, compensation, value);
+                    slot.compensation.store(compensation, std::memory_order_relaxed);
+                    slot.sum.store(sum, std::memory_order_relaxed);
+                    slot.sequence.store(sequence + 2, std::memory_order_release);
+                } else {
+                    slot.sum.store(slot.sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+                }
+            }
+
+            // the sum and the compensation of the owner, both from the same add
+            static std::pair<base_type, base_type> read(const shard& slot) noexcept {
+                if constexpr (mode == summation::compensated) {
+                    while (true) {
+                        const auto before = slot.sequence.load(std::memory_order_acquire);
+                        if (before % 2 == 0) {
+                            const auto sum          = slot.sum.load(std::memory_order_relaxed);
+                            const auto compensation = slot.compensation.load(std::memory_order_relaxed);
+                            std::atomic_thread_fence(std::memory_order_acquire);
+                            if (slot.sequence.load(std::memory_order_relaxed) == before) {
+                                return {sum, compensation};
+                            }
+                        }
+                        std::this_thread::yield();
+                    }
+                } else {
+                    return {slot.sum.load(std::memory_order_relaxed), base_type{0}};
+                }
+            }
+
+          public:
+            // allocates all shards, load does not allocate and add only the first time a thread gets its number
+            explicit sharded_accumulator(std::size_t shard_count = std::thread::hardware_concurrency())
+                : count{shard_count > 0 ? shard_count : 1},
+                  shards{std::make_unique<shard[]>(count)} {}
+
+            sharded_accumulator(const sharded_accumulator&)            = delete;
+            sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+            [[nodiscard]]
+            std::size_t shard_count() const noexcept {
+                return count;
+            }
+
+            // adds unit to the shard of the calling thread
+            void add(const unit_t& unit) noexcept { add_to(shards[detail::thread_number() % count], base_value(unit)); }
+
+            // adds unit to the given shard, index has to be less than shard_count()
+            void add(std::size_t index, const unit_t& unit) noexcept {
+                assert(index < count);
+                add_to(shards[index], base_value(unit));
+            }
+
+            // the value of one shard in base units
+            [[nodiscard]]
+            unit_t load(std::size_t index) const noexcept {
+                assert(index < count);
+                const auto& slot               = shards[index];
+                const auto [sum, compensation] = read(slot);
+                return unit_t{sum - compensation + slot.shared.load(std::memory_order_relaxed), 1, 0};
+            }
+
+            // the sum of all shards in base units
+            [[nodiscard]]
+            unit_t load() const noexcept {
+                base_type total = 0;
+                if constexpr (mode == summation::compensated) {
+                    base_type compensation = 0;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        const auto [sum, shard_compensation] = read(shards[i]);
+                        compensated_add(total, compensation, sum);
+                        compensated_add(total, compensation, -shard_compensation);
+                        compensated_add(total, compensation, shards[i].shared.load(std::memory_order_relaxed));
+                    }
+                    total -= compensation;
+                } else {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        total += shards[i].sum.load(std::memory_order_relaxed) + shards[i].shared.load(std::memory_order_relaxed);
+                    }
+                }
+                return unit_t{total, 1, 0};
+            }
+
+            // sets all shards to 0, adds that run at the same time may be lost or kept
+            void reset() noexcept {
+                for (std::size_t i = 0; i < count; ++i) {
+                    shards[i].sum.store(0, std::memory_order_relaxed);
+                    shards[i].compensation.store(0, std::memory_order_relaxed);
+                    shards[i].shared.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "unit_system/dimension.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // what shm_writer does if a shared memory object with its name already exists
+        enum class shm_existing {
+            fail,    // throws std::system_error with EEXIST, another writer may still use the channel
+            replace, // unlinks the old object, e.g. one left behind by a crashed writer. Readers that still map it see no new values.
+        };
+
+        namespace detail {
+
+            inline constexpr std::uint64_t shm_channel_magic   = 0x6d68732d74696e75; // "unit-shm"
+            inline constexpr std::uint32_t shm_channel_version = 1;
+
+            // the start of the shared memory, the values follow on the next cache line.
+            // magic is written last by the writer, a reader only uses a channel once it sees it.
+            // The fields up to value_size do not depend on the base type, so a reader can check it before reading the rest.
+            template <std::floating_point base_type>
+            struct shm_channel_header {
+                std::atomic<std::uint64_t> magic;
+                std::uint32_t              version;
+                std::uint32_t              value_size;
+                dimension                  unit_dimension;
+                base_type                  multiplier;
+                base_type                  offset;
+                std::uint64_t              capacity;
+
+                alignas(cache_line_size) std::atomic<std::uint64_t> tail;
+                alignas(cache_line_size) std::atomic<std::uint64_t> head;
+            };
+
+            template <std::floating_point base_type>
+            inline constexpr std::size_t shm_values_offset =
+                (sizeof(shm_channel_header<base_type>) + cache_line_size - 1) / cache_line_size * cache_line_size;
+
+            // a shared memory object mapped into this process, unmapped when destroyed
+            class shm_mapping {
+                void*       address = nullptr;
+                std::size_t length  = 0;
+
+                [[noreturn]]
+                static void fail(const std::string& what) {
+                    throw std::system_error{errno, std::generic_category(), what};
+                }
+
+                shm_mapping(int fd, std::size_t size, const std::string& name) {
+                    address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                    ::close(fd);
+                    if (address == MAP_FAILED) {
+                        address = nullptr;
+                        fail("mmap " + name);
+                    }
+                    length = size;
+                }
+
+              public:
+                shm_mapping() = default;
+
+                // creates a new zeroed object, what happens with an existing object with the same name depends on existing
+                static shm_mapping create(const std::string& name, std::size_t size, shm_existing existing) {
+                    if (existing == shm_existing::replace) {
+                        ::shm_unlink(name.c_str());
+                    }
+                    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+                    if (fd < 0) {
+                        fail("shm_open " + name);
+                    }
+                    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+                        const auto error = errno;
+                        ::close(fd);
+                        ::shm_unlink(name.c_str());
+                        errno = error;
+                        fail("ftruncate " + name);
+                    }
+                    return shm_mapping{fd, size, name};
+                }
+
+                // maps the whole existing object
+                static shm_mapping open(const std::string& name) {
+                    const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+                    if (fd < 0) {
+                        fail("shm_open " + name);
+                    }
+                    struct stat info {};
+                    if (::fstat(fd, &info) != 0) {
+                        ::close(fd);
+                        fail("fstat " + name);
+                    }
+                    return shm_mapping{fd, static_cast<std::size_t>(info.st_size), name};
+                }
+
+                shm_mapping(shm_mapping&& other) noexcept
+                    : address{std::exchange(other.address, nullptr)},
+                      length{std::exchange(other.length, 0)} {}
+
+                shm_mapping& operator=(shm_mapping&& other) noexcept {
+                    std::swap(address, other.address);
+                    std::swap(length, other.length);
+                    return *this;
+                }
+
+                ~shm_mapping() {
+                    if (address != nullptr) {
+                        ::munmap(address, length);
+                    }
+                }
+
+                [[nodiscard]]
+                void* data() const noexcept {
+                    return address;
+                }
+
+                [[nodiscard]]
+                std::size_t size() const noexcept {
+                    return length;
+                }
+            };
+
+        } // namespace detail
+
+        // The producer side of a ring buffer in POSIX shared memory, e.g. from an acquisition daemon to an analytics process.
+        //
+        // The shared memory starts with a header that describes the values (dimension, size of the base type, multiplier
+        // and offset), followed by the raw values. All values use the multiplier and offset of the unit passed to the constructor.
+        // There is one writer and one reader, both only use atomic loads and stores of the indices, so neither side blocks.
+        // The shared memory object is created by the constructor and unlinked by the destructor,
+        // readers that still have it mapped keep working until they are destroyed.
+        // If the name is already taken the constructor throws std::system_error (EEXIST) unless shm_existing::replace is passed.
+        template <dimensioned_unit unit_t>
+        class shm_writer {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+          private:
+            using header_type = detail::shm_channel_header<base_type>;
+
+            std::string         name_;
+            detail::shm_mapping mapping;
+            header_type*        header      = nullptr;
+            base_type*          values      = nullptr;
+            std::uint64_t       mask        = 0;
+            std::uint64_t       cached_head = 0;
+
+          public:
+            // name is a POSIX shared memory name like "/sensor_current", capacity is rounded up to a power of two
+            shm_writer(std::string name, std::size_t capacity, const unit_t& like = unit_t{0, 1, 0}, shm_existing existing = shm_existing::fail)
+                : name_{std::move(name)} {
+                static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "the indices have to be lock-free to work across processes");
+
+                capacity = std::bit_ceil(std::max<std::size_t>(capacity, 2));
+                mapping  = detail::shm_mapping::create(name_, detail::shm_values_offset<base_type> + capacity * sizeof(base_type), existing);
+
+                header                 = ::new (mapping.data()) header_type{};
+                header->version        = detail::shm_channel_version;
+                header->value_size     = sizeof(base_type);
+                header->unit_dimension = dimension_of<unit_t>;
+                header->multiplier     = like.mult();
+                header->offset         = like.off();
+                header->capacity       = capacity;
+                values                 = reinterpret_cast<base_type*>(static_cast<char*>(mapping.data()) + detail::shm_values_offset<base_type>);
+                mask                   = capacity - 1;
+                header->magic.store(detail::shm_channel_magic, std::memory_order_release);
+            }
+
+            // only the moved to writer unlinks the channel
+            shm_writer(shm_writer&& other) noexcept
+                : name_{std::move(other.name_)},
+                  mapping{std::move(other.mapping)},
+                  header{std::exchange(other.header, nullptr)},
+                  values{other.values},
+                  mask{other.mask},
+                  cached_head{other.cached_head} {}
+
+            shm_writer& operator=(shm_writer&& other) noexcept {
+                std::swap(name_, other.name_);
+                std::swap(mapping, other.mapping);
+                std::swap(header, other.header);
+                std::swap(values, other.values);
+                std::swap(mask, other.mask);
+                std::swap(cached_head, other.cached_head);
+                return *this;
+            }
+
+            ~shm_writer() {
+                if (header != nullptr) {
+                    ::shm_unlink(name_.c_str());
+                }
+            }
+
+            [[nodiscard]]
+            const std::string& name() const noexcept {
+                return name_;
+            }
+
+            [[nodiscard]]
+            std::size_t capacity() const noexcept {
+                return static_cast<std::size_t>(header->capacity);
+            }
+
+            [[nodiscard]]
+            base_type mult() const noexcept {
+                return header->multiplier;
+            }
+
+            [[nodiscard]]
+            base_type off() const noexcept {
+                return header->offset;
+            }
+
+            // the free space up to the end of the buffer, values written into it are published by commit
+            [[nodiscard]]
+            std::span<base_type> reserve() noexcept {
+                const auto tail = header->tail.load(std::memory_order_relaxed);
+                if (tail - cached_head == header->capacity) {
+                    cached_head = header->head.load(std::memory_order_acquire);
+                }
+                const auto index = tail & mask;
+                const auto free  = header->capacity - (tail - cached_head);
+                return {values + index, static_cast<std::size_t>(std::min(free, header->capacity - index))};
+            }
+
+            // publishes the first count values of the last reserve
+            void commit(std::size_t count) noexcept {
+                header->tail.store(header->tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+            }
+
+            // copies as many values as fit, they have to use the multiplier and offset of the channel
+            std::size_t write_values(std::span<const base_type> in) noexcept {
+                std::size_t written = 0;
+                while (written < in.size()) {
+                    const auto space = reserve();
+                    const auto count = std::min(space.size(), in.size() - written);
+                    if (count == 0) {
+                        break;
+                    }
+                    std::copy_n(in.begin() + written, count, space.begin());
+                    commit(count);
+                    written += count;
+                }
+                return written;
+            }
+
+            // converts and writes as many units as fit
+            std::size_t write(std::span<const unit_t> in) noexcept {
+                std::size_t written = 0;
+                while (written < in.size()) {
+                    const auto space = reserve();
+                    const auto count = std::min(space.size(), in.size() - written);
+                    if (count == 0) {
+                        break;
+                    }
+                    for (std::size_t i = 0; i < count; ++i) {
+                        space[i] = in[written + i].convert_copy(mult(), off()).val();
+                    }
+                    commit(count);
+                    written += count;
+                }
+                return written;
+            }
+        };
+
+        // The consumer side of a shm_writer, usually in another process.
+        // The constructor checks that the channel holds unit_t with the same base type and throws std::invalid_argument otherwise,
+        // or std::system_error if the channel does not exist.
+        template <dimensioned_unit unit_t>
+        class shm_reader {
+          public:
+            using unit_type = unit_t;
+            using base_type = unit_base_t<unit_t>;
+
+          private:
+            using header_type = detail::shm_channel_header<base_type>;
+
+            detail::shm_mapping mapping;
+            header_type*        header      = nullptr;
+            const base_type*    values      = nullptr;
+            std::uint64_t       mask        = 0;
+            std::uint64_t       cached_tail = 0;
+
+          public:
+            explicit shm_reader(const std::string& name)
+                : mapping{detail::shm_mapping::open(name)} {
+                if (mapping.size() < detail::shm_values_offset<base_type>) {
+                    throw std::invalid_argument{name + " is not a unit channel"};
+                }
+                header = std::launder(reinterpret_cast<header_type*>(mapping.data()));
+                if (header->magic.load(std::memory_order_acquire) != detail::shm_channel_magic ||
+                    header->version != detail::shm_channel_version) {
+                    throw std::invalid_argument{name + " is not a unit channel or not initialized yet"};
+                }
+                if (header->value_size != sizeof(base_type)) {
+                    throw std::invalid_argument{name + " uses a different base type"};
+                }
+                if (header->unit_dimension != dimension_of<unit_t>) {
+                    throw std::invalid_argument{name + " holds a unit of a different dimension"};
+                }
+                if (!std::has_single_bit(header->capacity) ||
+                    mapping.size() < detail::shm_values_offset<base_type> + header->capacity * sizeof(base_type)) {
+                    throw std::invalid_argument{name + " has an invalid capacity"};
+                }
+                values = reinterpret_cast<const base_type*>(static_cast<const char*>(mapping.data()) + detail::shm_values_offset<base_type>);
+                mask   = header->capacity - 1;
+            }
+
+            [[nodiscard]]
+            std::size_t capacity() const noexcept {
+                return static_cast<std::size_t>(header->capacity);
+            }
+
+            [[nodiscard]]
+            base_type mult() const noexcept {
+                return header->multiplier;
+            }
+
+            [[nodiscard]]
+            base_type off() const noexcept {
+                return header->offset;
+            }
+
+            // the written values up to the end of the buffer without copying them, valid until they are consumed.
+            // Values that wrap around the end of the buffer are returned by the next peek after consume.
+            [[nodiscard]]
+            std::span<const base_type> peek() noexcept {
+                const auto head = header->head.load(std::memory_order_relaxed);
+                if (cached_tail == head) {
+                    cached_tail = header->tail.load(std::memory_order_acquire);
+                }
+                const auto index = head & mask;
+                return {values + index, static_cast<std::size_t>(std::min(cached_tail - head, header->capacity - index))};
+            }
+
+            // frees the first count values of the last peek for the writer
+            void consume(std::size_t count) noexcept {
+                header->head.store(header->head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+            }
+
+            // copies as many units as are available into out
+            std::size_t read(std::span<unit_t> out) noexcept {
+                std::size_t received = 0;
+                while (received < out.size()) {
+                    const auto available = peek();
+                    const auto count     = std::min(available.size(), out.size() - received);
+                    if (count == 0) {
+                        break;
+                    }
+                    for (std::size_t i = 0; i < count; ++i) {
+                        out[received + i] = unit_t{available[i], mult(), off()};
+                    }
+                    consume(count);
+                    received += count;
+                }
+                return received;
+            }
+        };
+
+    } // namespace unit_system
+} // namespace sakurajin
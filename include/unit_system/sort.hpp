@@ -0,0 +1,248 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        namespace detail {
+
+            // the value of a unit in base units, adding zero turns -0 into +0 so both zeros get the same sort key
+            template <unit_type unit_t>
+            unit_base_t<unit_t> sort_key(const unit_t& unit) {
+                return base_value(unit) + unit_base_t<unit_t>{0};
+            }
+
+            // floating point types whose IEEE bit pattern can be radix sorted
+            template <class base_type>
+            concept radix_sortable = std::numeric_limits<base_type>::is_iec559 && (sizeof(base_type) == 4 || sizeof(base_type) == 8);
+
+            template <radix_sortable base_type>
+            using radix_bits_t = std::conditional_t<sizeof(base_type) == 4, std::uint32_t, std::uint64_t>;
+
+            // maps the IEEE bit pattern to an unsigned integer with the same ordering as the floating point values
+            template <radix_sortable base_type>
+            radix_bits_t<base_type> radix_bits(base_type value) {
+                using bits_t = radix_bits_t<base_type>;
+
+                constexpr auto sign = bits_t{1} << (sizeof(bits_t) * 8 - 1);
+                const auto     bits = std::bit_cast<bits_t>(value);
+                return (bits & sign) ? ~bits : (bits | sign);
+            }
+
+            // stable LSD radix sort of (key, index) pairs with 11 bit digits.
+            // Digits that are the same for all keys (usually most of the exponent) are skipped.
+            template <class bits_t, class index_t>
+            void radix_sort_pairs(std::vector<bits_t>& keys, std::vector<index_t>& indices) {
+                constexpr std::size_t digit_bits = 11;
+                constexpr std::size_t buckets    = std::size_t{1} << digit_bits;
+                constexpr std::size_t passes     = (sizeof(bits_t) * 8 + digit_bits - 1) / digit_bits;
+
+                const auto size = keys.size();
+
+                std::vector<std::array<std::size_t, buckets>> histograms(passes);
+                for (const auto key : keys) {
+                    for (std::size_t pass = 0; pass < passes; ++pass) {
+                        ++histograms[pass][(key >> (pass * digit_bits)) & (buckets - 1)];
+                    }
+                }
+
+                std::vector<bits_t>  keys_tmp(size);
+                std::vector<index_t> indices_tmp(size);
+                for (std::size_t pass = 0; pass < passes; ++pass) {
+                    auto& histogram = histograms[pass];
+                    if (std::find(histogram.begin(), histogram.end(), size) != histogram.end()) {
+                        continue;
+                    }
+
+                    std::size_t position = 0;
+                    for (auto& bucket : histogram) {
+                        const auto count = bucket;
+                        bucket           = position;
+                        position += count;
+                    }
+
+                    const auto shift = pass * digit_bits;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        const auto target   = histogram[(keys[i] >> shift) & (buckets - 1)]++;
+                        keys_tmp[target]    = keys[i];
+                        indices_tmp[target] = indices[i];
+                    }
+                    keys.swap(keys_tmp);
+                    indices.swap(indices_tmp);
+                }
+            }
+
+            // moves the units into the order given by the sorted entries, index_of(entry) is the old position of an element.
+            // The gather and the copy back are independent for every element, so both are split by the policy.
+            template <execution_policy policy_t, unit_type unit_t, class entry_t, class index_of_t>
+            void gather(const policy_t& policy, std::span<unit_t> values, const std::vector<entry_t>& order, index_of_t index_of) {
+                std::vector<unit_t> sorted(values.size());
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        sorted[i] = values[index_of(order[i])];
+                    }
+                });
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    std::copy(sorted.begin() + static_cast<std::ptrdiff_t>(begin),
+                              sorted.begin() + static_cast<std::ptrdiff_t>(end),
+                              values.begin() + static_cast<std::ptrdiff_t>(begin));
+                });
+            }
+
+            // moves the units into the order given by the indices
+            template <execution_policy policy_t, unit_type unit_t, class index_t>
+            void apply_order(const policy_t& policy, std::span<unit_t> values, const std::vector<index_t>& order) {
+                gather(policy, values, order, [](index_t index) { return static_cast<std::size_t>(index); });
+            }
+
+            template <unit_type unit_t>
+            struct keyed_index {
+                unit_base_t<unit_t> key;
+                std::size_t         index;
+
+                bool operator<(const keyed_index& other) const { return key < other.key; }
+            };
+
+            template <execution_policy policy_t, unit_type unit_t>
+            std::vector<keyed_index<unit_t>> keyed_indices(const policy_t& policy, std::span<const unit_t> values) {
+                std::vector<keyed_index<unit_t>> retval(values.size());
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        retval[i] = {sort_key(values[i]), i};
+                    }
+                });
+                return retval;
+            }
+
+            template <execution_policy policy_t, unit_type unit_t>
+            void apply_keyed_order(const policy_t& policy, std::span<unit_t> values, const std::vector<keyed_index<unit_t>>& order) {
+                gather(policy, values, order, [](const keyed_index<unit_t>& entry) { return entry.index; });
+            }
+
+            // the keys are computed and the units are moved with the policy, the radix passes run on the calling thread
+            template <unit_type unit_t, class index_t, execution_policy policy_t>
+            void radix_sort(const policy_t& policy, std::span<unit_t> values) {
+                using bits_t = radix_bits_t<unit_base_t<unit_t>>;
+
+                std::vector<bits_t>  keys(values.size());
+                std::vector<index_t> indices(values.size());
+                for_each_range(policy, values.size(), [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        keys[i]    = radix_bits(sort_key(values[i]));
+                        indices[i] = static_cast<index_t>(i);
+                    }
+                });
+                radix_sort_pairs(keys, indices);
+                apply_order(policy, values, indices);
+            }
+
+            // below this size sorting the precomputed keys with std::stable_sort beats the radix passes
+            inline constexpr std::size_t radix_sort_threshold = 1024;
+
+        } // namespace detail
+
+        // All of these take any contiguous range of units (std::vector, std::array, std::span, ...) and sort by the value in
+        // base units. Each key is computed exactly once per element, so no comparison has to convert between multipliers.
+        // With an execution policy the keys are computed and the units are moved into place on the threads of the pool,
+        // the sorting of the keys itself runs on the calling thread.
+        // Sorting NaN values is not supported, the same as with std::sort.
+
+        // stable sort, LSD radix sort on the bit pattern for float and double values
+        template <execution_policy policy_t, unit_range range_t>
+        void stable_sort(const policy_t& policy, range_t&& range) {
+            using unit_t = std::ranges::range_value_t<range_t>;
+            std::span<unit_t> values{range};
+
+            if constexpr (detail::radix_sortable<unit_base_t<unit_t>>) {
+                if (values.size() >= detail::radix_sort_threshold) {
+                    if (values.size() <= std::numeric_limits<std::uint32_t>::max()) {
+                        detail::radix_sort<unit_t, std::uint32_t>(policy, values);
+                    } else {
+                        detail::radix_sort<unit_t, std::size_t>(policy, values);
+                    }
+                    return;
+                }
+            }
+
+            auto order = detail::keyed_indices<policy_t, unit_t>(policy, values);
+            std::stable_sort(order.begin(), order.end());
+            detail::apply_keyed_order(policy, values, order);
+        }
+
+        template <unit_range range_t>
+        void stable_sort(range_t&& range) {
+            stable_sort(seq, std::forward<range_t>(range));
+        }
+
+        // the radix sort is already stable, so sort only differs from stable_sort for types without a radix key
+        template <execution_policy policy_t, unit_range range_t>
+        void sort(const policy_t& policy, range_t&& range) {
+            using unit_t = std::ranges::range_value_t<range_t>;
+            std::span<unit_t> values{range};
+
+            if constexpr (detail::radix_sortable<unit_base_t<unit_t>>) {
+                stable_sort(policy, values);
+            } else {
+                auto order = detail::keyed_indices<policy_t, unit_t>(policy, values);
+                std::sort(order.begin(), order.end());
+                detail::apply_keyed_order(policy, values, order);
+            }
+        }
+
+        template <unit_range range_t>
+        void sort(range_t&& range) {
+            sort(seq, std::forward<range_t>(range));
+        }
+
+        // the same as std::partial_sort, the first `middle` elements are the smallest ones in order
+        template <execution_policy policy_t, unit_range range_t>
+        void partial_sort(const policy_t& policy, range_t&& range, std::size_t middle) {
+            using unit_t = std::ranges::range_value_t<range_t>;
+            std::span<unit_t> values{range};
+
+            middle     = std::min(middle, values.size());
+            auto order = detail::keyed_indices<policy_t, unit_t>(policy, values);
+            std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(middle), order.end());
+            detail::apply_keyed_order(policy, values, order);
+        }
+
+        template <unit_range range_t>
+        void partial_sort(range_t&& range, std::size_t middle) {
+            partial_sort(seq, std::forward<range_t>(range), middle);
+        }
+
+        // the same as std::nth_element, afterwards values[nth] is the element that would be there if the range was sorted
+        template <execution_policy policy_t, unit_range range_t>
+        void nth_element(const policy_t& policy, range_t&& range, std::size_t nth) {
+            using unit_t = std::ranges::range_value_t<range_t>;
+            std::span<unit_t> values{range};
+
+            if (nth >= values.size()) {
+                return;
+            }
+            auto order = detail::keyed_indices<policy_t, unit_t>(policy, values);
+            std::nth_element(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(nth), order.end());
+            detail::apply_keyed_order(policy, values, order);
+        }
+
+        template <unit_range range_t>
+        void nth_element(range_t&& range, std::size_t nth) {
+            nth_element(seq, std::forward<range_t>(range), nth);
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // A lazy stream of units produced by a coroutine, one batch per resume.
+        //
+        // The coroutine produces values with co_yield, either a whole batch as a span (or a vector) or a single unit.
+        // Iterating the stream resumes the coroutine once per batch, so the cost of a resume is shared by all values of a batch.
+        // A batch is only valid until the stream is resumed again, stages that keep values have to copy them.
+        //
+        //     quantity_stream<length> read_lengths() {
+        //         std::vector<length> buffer;
+        //         while (fill(buffer)) {
+        //             co_yield buffer;
+        //         }
+        //     }
+        //
+        // Stages like convert_to, where and window_sum are chained with operator| and run lazily as well, each of them owns one
+        // buffer that grows to the largest batch it has seen, so the memory does not depend on the length of the stream.
+        template <unit_type unit_t>
+        class quantity_stream {
+          public:
+            using unit_type  = unit_t;
+            using batch_type = std::span<const unit_t>;
+
+            struct promise_type {
+                batch_type         current;
+                unit_t             single{0, 1, 0};
+                std::exception_ptr error;
+
+                quantity_stream get_return_object() noexcept { return quantity_stream{handle_type::from_promise(*this)}; }
+
+                std::suspend_always initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+
+                std::suspend_always yield_value(batch_type batch) noexcept {
+                    current = batch;
+                    return {};
+                }
+
+                std::suspend_always yield_value(const unit_t& unit) noexcept {
+                    single  = unit;
+                    current = batch_type{&single, 1};
+                    return {};
+                }
+
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { error = std::current_exception(); }
+            };
+
+            using handle_type = std::coroutine_handle<promise_type>;
+
+            // iterates the batches, an exception thrown by the coroutine is rethrown by begin or operator++
+            class iterator {
+                handle_type handle{};
+
+                void resume() {
+                    handle.resume();
+                    if (handle.done() && handle.promise().error) {
+                        std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+                    }
+                }
+
+              public:
+                using value_type      = batch_type;
+                using difference_type = std::ptrdiff_t;
+
+                iterator() = default;
+
+                explicit iterator(handle_type coroutine)
+                    : handle{coroutine} {
+                    resume();
+                }
+
+                batch_type operator*() const noexcept { return handle.promise().current; }
+
+                iterator& operator++() {
+                    resume();
+                    return *this;
+                }
+
+                void operator++(int) { ++*this; }
+
+                // a default constructed iterator has no coroutine and is always at the end
+                bool operator==(std::default_sentinel_t) const noexcept { return !handle || handle.done(); }
+            };
+
+          private:
+            handle_type handle;
+
+            explicit quantity_stream(handle_type coroutine) noexcept
+                : handle{coroutine} {}
+
+          public:
+            quantity_stream(quantity_stream&& other) noexcept
+                : handle{std::exchange(other.handle, nullptr)} {}
+
+            quantity_stream& operator=(quantity_stream&& other) noexcept {
+                if (this != &other) {
+                    if (handle) {
+                        handle.destroy();
+                    }
+                    handle = std::exchange(other.handle, nullptr);
+                }
+                return *this;
+            }
+
+            ~quantity_stream() {
+                if (handle) {
+                    handle.destroy();
+                }
+            }
+
+            // starts the coroutine, a stream can only be iterated once
+            iterator begin() { return iterator{handle}; }
+
+            std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+        };
+
+        // a stream of the values of range in batches of batch_size, the range has to outlive the stream
+        template <unit_range range_t>
+        quantity_stream<std::ranges::range_value_t<range_t>> stream_batches(const range_t& range, std::size_t batch_size) {
+            const std::span values{range};
+            batch_size = std::max<std::size_t>(batch_size, 1);
+            for (std::size_t begin = 0; begin < values.size(); begin += batch_size) {
+                co_yield values.subspan(begin, std::min(batch_size, values.size() - begin));
+            }
+        }
+
+        // a temporary container would be destroyed before the stream reads it, views like std::span are fine
+        template <unit_range range_t>
+            requires(!std::is_lvalue_reference_v<range_t> && !std::ranges::borrowed_range<range_t>)
+        quantity_stream<std::ranges::range_value_t<range_t>> stream_batches(range_t&& range, std::size_t batch_size) = delete;
+
+        namespace detail {
+
+            template <unit_type unit_t>
+            quantity_stream<unit_t> convert_stream(quantity_stream<unit_t> in, unit_base_t<unit_t> multiplier, unit_base_t<unit_t> offset) {
+                std::vector<unit_t> buffer;
+                for (const auto batch : in) {
+                    buffer.resize(std::max(buffer.size(), batch.size()), unit_t{0, multiplier, offset});
+                    for (std::size_t i = 0; i < batch.size(); ++i) {
+                        buffer[i] = batch[i].convert_copy(multiplier, offset);
+                    }
+                    co_yield std::span<const unit_t>{buffer.data(), batch.size()};
+                }
+            }
+
+            template <unit_type unit_t, class pred_t>
+            quantity_stream<unit_t> where_stream(quantity_stream<unit_t> in, pred_t pred) {
+                std::vector<unit_t> buffer;
+                for (const auto batch : in) {
+                    buffer.clear();
+                    for (const auto& value : batch) {
+                        if (pred(value)) {
+                            buffer.push_back(value);
+                        }
+                    }
+                    // empty batches are skipped, the next stage is only resumed if there is something to do
+                    if (!buffer.empty()) {
+                        co_yield buffer;
+                    }
+                }
+            }
+
+            template <unit_type unit_t>
+            quantity_stream<unit_t> window_sum_stream(quantity_stream<unit_t> in, std::size_t window) {
+                using base_type = unit_base_t<unit_t>;
+
+                std::vector<unit_t> buffer;
+                base_type           sum    = 0;
+                std::size_t         filled = 0;
+                for (const auto batch : in) {
+                    buffer.clear();
+                    for (const auto& value : batch) {
+                        sum += base_value(value);
+                        if (++filled == window) {
+                            buffer.emplace_back(sum, 1, 0);
+                            sum    = 0;
+                            filled = 0;
+                        }
+                    }
+                    if (!buffer.empty()) {
+                        co_yield buffer;
+                    }
+                }
+            }
+
+        } // namespace detail
+
+        // converts every value to the given multiplier and offset, e.g. convert_to(1000.0) for km from m
+        template <std::floating_point base_type>
+        struct convert_to {
+            base_type multiplier;
+            base_type offset;
+
+            explicit convert_to(base_type new_multiplier, base_type new_offset = 0)
+                : multiplier{new_multiplier},
+                  offset{new_offset} {}
+
+            template <unit_type unit_t>
+            quantity_stream<unit_t> operator()(quantity_stream<unit_t> in) const {
+                using unit_base = unit_base_t<unit_t>;
+                return detail::convert_stream(std::move(in), static_cast<unit_base>(multiplier), static_cast<unit_base>(offset));
+            }
+        };
+
+        // only keeps the values pred returns true for, e.g. where(above(5_A)) with the predicates of filter.hpp
+        template <class pred_t>
+        struct where {
+            pred_t pred;
+
+            explicit where(pred_t predicate)
+                : pred{std::move(predicate)} {}
+
+            template <unit_type unit_t>
+                requires std::predicate<const pred_t&, const unit_t&>
+            quantity_stream<unit_t> operator()(quantity_stream<unit_t> in) const {
+                return detail::where_stream(std::move(in), pred);
+            }
+        };
+
+        // the sum of every window of size values (tumbling windows) in base units, values after the last full window are dropped
+        struct window_sum {
+            std::size_t size;
+
+            explicit window_sum(std::size_t window_size)
+                : size{std::max<std::size_t>(window_size, 1)} {}
+
+            template <unit_type unit_t>
+            quantity_stream<unit_t> operator()(quantity_stream<unit_t> in) const {
+                return detail::window_sum_stream(std::move(in), size);
+            }
+        };
+
+        // stream | stage, for example stream_batches(samples, 256) | convert_to(1e-3) | where(above(5_mA)) | window_sum(100)
+        template <unit_type unit_t, class stage_t>
+            requires std::invocable<const stage_t&, quantity_stream<unit_t>>
+        auto operator|(quantity_stream<unit_t>&& in, const stage_t& stage) {
+            return stage(std::move(in));
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
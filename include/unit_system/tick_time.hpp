@@ -0,0 +1,192 @@
+#pragma once
+
+#include "unit_system/chrono.hpp"
+#include "unit_system/concepts.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // A duration as an integer number of ticks with a compile time period, e.g. nanoseconds as std::int64_t.
+        //
+        // time_si stores a floating point value, so adding up many nanosecond durations rounds with every addition.
+        // tick_time adds, subtracts and compares integers and is exact as long as the ticks do not overflow
+        // (int64 nanoseconds cover 292 years). It stores a std::chrono::duration, so it converts to and from
+        // std::chrono without any cost: durations that convert without loss (e.g. std::chrono::microseconds to nanoseconds)
+        // convert implicitly, for all other durations tick_cast rounds to the nearest tick.
+        // Every operator between time_si and another unit (speed * time -> length, energy / time -> power, ...)
+        // also works with tick_time, the ticks are converted to a time_si with the period as multiplier.
+        template <std::signed_integral rep_t = std::int64_t, class period_t = std::nano>
+        class tick_time {
+          public:
+            using rep         = rep_t;
+            using period      = period_t;
+            using chrono_type = std::chrono::duration<rep_t, period_t>;
+
+          private:
+            chrono_type duration{0};
+
+          public:
+            constexpr tick_time() noexcept = default;
+
+            constexpr explicit tick_time(rep_t ticks) noexcept
+                : duration{ticks} {}
+
+            // every std::chrono::duration that converts without loss, e.g. 5ms or std::chrono::seconds{1}
+            template <class other_rep, class other_period>
+                requires std::is_convertible_v<std::chrono::duration<other_rep, other_period>, chrono_type>
+            constexpr tick_time(const std::chrono::duration<other_rep, other_period>& other) noexcept
+                : duration{other} {}
+
+            // tick_time with a coarser period, e.g. tick_time<std::int64_t, std::milli> to nanoseconds
+            template <class other_rep, class other_period>
+                requires std::is_convertible_v<std::chrono::duration<other_rep, other_period>, chrono_type>
+            constexpr tick_time(const tick_time<other_rep, other_period>& other) noexcept
+                : duration{other.chrono()} {}
+
+            [[nodiscard]]
+            constexpr rep_t count() const noexcept {
+                return duration.count();
+            }
+
+            [[nodiscard]]
+            constexpr chrono_type chrono() const noexcept {
+                return duration;
+            }
+
+            constexpr operator chrono_type() const noexcept { return duration; }
+
+            // the same duration as time_si with the period as multiplier.
+            // The tick count is exact in long double, with double only up to 2^53 ticks. num / den is rounded to base_type.
+            template <std::floating_point base_type = UNIT_SYSTEM_DEFAULT_TYPE>
+            [[nodiscard]]
+            time_si_t<base_type> to_unit() const noexcept {
+                return time_si_t<base_type>{static_cast<base_type>(duration.count()),
+                                            static_cast<base_type>(period_t::num) / static_cast<base_type>(period_t::den)};
+            }
+
+            friend constexpr auto operator<=>(const tick_time&, const tick_time&) noexcept = default;
+            friend constexpr bool operator==(const tick_time&, const tick_time&) noexcept  = default;
+
+            friend constexpr tick_time operator+(tick_time a, tick_time b) noexcept { return tick_time{a.duration + b.duration}; }
+            friend constexpr tick_time operator-(tick_time a, tick_time b) noexcept { return tick_time{a.duration - b.duration}; }
+            friend constexpr tick_time operator%(tick_time a, tick_time b) noexcept { return tick_time{a.duration % b.duration}; }
+            // how many times b fits into a, rounded towards zero
+            friend constexpr rep_t operator/(tick_time a, tick_time b) noexcept { return a.duration / b.duration; }
+
+            constexpr tick_time operator-() const noexcept { return tick_time{-duration}; }
+
+            constexpr tick_time& operator+=(tick_time other) noexcept {
+                duration += other.duration;
+                return *this;
+            }
+            constexpr tick_time& operator-=(tick_time other) noexcept {
+                duration -= other.duration;
+                return *this;
+            }
+
+            // scaling by integers is exact, dividing rounds towards zero like std::chrono
+            template <std::integral scalar_t>
+            friend constexpr tick_time operator*(tick_time time, scalar_t scalar) noexcept {
+                return tick_time{time.count() * static_cast<rep_t>(scalar)};
+            }
+            template <std::integral scalar_t>
+            friend constexpr tick_time operator*(scalar_t scalar, tick_time time) noexcept {
+                return time * scalar;
+            }
+            template <std::integral scalar_t>
+            friend constexpr tick_time operator/(tick_time time, scalar_t scalar) noexcept {
+                return tick_time{time.count() / static_cast<rep_t>(scalar)};
+            }
+        };
+
+        using tick_ns = tick_time<std::int64_t, std::nano>;
+        using tick_us = tick_time<std::int64_t, std::micro>;
+        using tick_ms = tick_time<std::int64_t, std::milli>;
+        using tick_s  = tick_time<std::int64_t, std::ratio<1>>;
+
+        // adding or subtracting different periods gives the finer period, e.g. tick_ms + tick_us -> tick_us
+        template <class rep_t, class period_t, class other_rep, class other_period>
+        [[nodiscard]]
+        constexpr auto operator+(const tick_time<rep_t, period_t>& a, const tick_time<other_rep, other_period>& b) noexcept {
+            const auto sum = a.chrono() + b.chrono();
+            return tick_time<typename decltype(sum)::rep, typename decltype(sum)::period>{sum};
+        }
+
+        template <class rep_t, class period_t, class other_rep, class other_period>
+        [[nodiscard]]
+        constexpr auto operator-(const tick_time<rep_t, period_t>& a, const tick_time<other_rep, other_period>& b) noexcept {
+            const auto difference = a.chrono() - b.chrono();
+            return tick_time<typename decltype(difference)::rep, typename decltype(difference)::period>{difference};
+        }
+
+        template <class time_t>
+        inline constexpr bool is_tick_time = false;
+
+        template <class rep_t, class period_t>
+        inline constexpr bool is_tick_time<tick_time<rep_t, period_t>> = true;
+
+        // time rounded to the nearest tick, e.g. tick_cast<tick_ns>(1.5_us)
+        template <class time_t, std::floating_point base_type>
+            requires is_tick_time<time_t>
+        [[nodiscard]]
+        time_t tick_cast(const time_si_t<base_type>& time) {
+            using period = typename time_t::period;
+            const auto ticks = base_value(time) * static_cast<base_type>(period::den) / static_cast<base_type>(period::num);
+            return time_t{static_cast<typename time_t::rep>(std::llround(ticks))};
+        }
+
+        // any std::chrono::duration or tick_time rounded to the nearest tick, the same as std::chrono::round
+        template <class time_t, class rep_t, class period_t>
+            requires is_tick_time<time_t>
+        [[nodiscard]]
+        constexpr time_t tick_cast(const std::chrono::duration<rep_t, period_t>& time) {
+            return time_t{std::chrono::round<typename time_t::chrono_type>(time)};
+        }
+
+        template <class time_t, class rep_t, class period_t>
+            requires is_tick_time<time_t>
+        [[nodiscard]]
+        constexpr time_t tick_cast(const tick_time<rep_t, period_t>& time) {
+            return tick_cast<time_t>(time.chrono());
+        }
+
+        // the same as unit_cast for std::chrono durations, without the detour over double
+        template <class rep_t, class period_t, class mult_t = UNIT_SYSTEM_DEFAULT_TYPE>
+            requires std::convertible_to<mult_t, UNIT_SYSTEM_DEFAULT_TYPE>
+        time_si unit_cast(const tick_time<rep_t, period_t>& time, mult_t new_multiplier = 1.0) {
+            return time.to_unit().convert_multiplier(new_multiplier);
+        }
+
+        // the operators between time_si and the other units, the ticks are converted to time_si_t of the other unit's base type
+        template <unit_type unit_t, class rep_t, class period_t>
+            requires requires(const unit_t& unit, const time_si_t<unit_base_t<unit_t>>& time) { unit * time; }
+        [[nodiscard]]
+        auto operator*(const unit_t& unit, const tick_time<rep_t, period_t>& time) {
+            return unit * time.template to_unit<unit_base_t<unit_t>>();
+        }
+
+        template <unit_type unit_t, class rep_t, class period_t>
+            requires requires(const unit_t& unit, const time_si_t<unit_base_t<unit_t>>& time) { time * unit; }
+        [[nodiscard]]
+        auto operator*(const tick_time<rep_t, period_t>& time, const unit_t& unit) {
+            return time.template to_unit<unit_base_t<unit_t>>() * unit;
+        }
+
+        template <unit_type unit_t, class rep_t, class period_t>
+            requires requires(const unit_t& unit, const time_si_t<unit_base_t<unit_t>>& time) { unit / time; }
+        [[nodiscard]]
+        auto operator/(const unit_t& unit, const tick_time<rep_t, period_t>& time) {
+            return unit / time.template to_unit<unit_base_t<unit_t>>();
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,313 @@
+#pragma once
+
+#include "unit_system/concepts.hpp"
+#include "unit_system/dimension.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+
+namespace sakurajin {
+    namespace unit_system {
+
+        // what a unit symbol stands for: a value in this unit is converted to base units with value * mult + off
+        struct unit_definition {
+            dimension                dim;
+            UNIT_SYSTEM_DEFAULT_TYPE mult = 1;
+            UNIT_SYSTEM_DEFAULT_TYPE off  = 0;
+
+            friend constexpr bool operator==(const unit_definition&, const unit_definition&) = default;
+        };
+
+        struct named_unit {
+            std::string_view symbol;
+            unit_definition  definition;
+        };
+
+        // the symbols of all literals of the library without the leading underscore, e.g. "km" for _km
+        inline constexpr named_unit builtin_units[] = {
+            {"a", {dimension_of<time_si>, 31536000000.0, 0.0}},
+            {"d", {dimension_of<time_si>, 86400000.0, 0.0}},
+            {"h", {dimension_of<time_si>, 3600.0, 0.0}},
+            {"minute", {dimension_of<time_si>, 60.0, 0.0}},
+            {"s", {dimension_of<time_si>, 1.0, 0.0}},
+            {"ms", {dimension_of<time_si>, 0.001, 0.0}},
+            {"us", {dimension_of<time_si>, 1e-06, 0.0}},
+            {"ns", {dimension_of<time_si>, 1e-09, 0.0}},
+            {"ps", {dimension_of<time_si>, 1e-12, 0.0}},
+            {"fs", {dimension_of<time_si>, 1e-15, 0.0}},
+            {"as", {dimension_of<time_si>, 1e-18, 0.0}},
+            {"m", {dimension_of<length>, 1.0, 0.0}},
+            {"km", {dimension_of<length>, 1000.0, 0.0}},
+            {"dm", {dimension_of<length>, 0.1, 0.0}},
+            {"cm", {dimension_of<length>, 0.01, 0.0}},
+            {"mm", {dimension_of<length>, 0.001, 0.0}},
+            {"um", {dimension_of<length>, 1e-06, 0.0}},
+            {"nm", {dimension_of<length>, 1e-09, 0.0}},
+            {"pm", {dimension_of<length>, 1e-12, 0.0}},
+            {"fm", {dimension_of<length>, 1e-15, 0.0}},
+            {"am", {dimension_of<length>, 1e-18, 0.0}},
+            {"t", {dimension_of<mass>, 1000.0, 0.0}},
+            {"kg", {dimension_of<mass>, 1.0, 0.0}},
+            {"g", {dimension_of<mass>, 0.001, 0.0}},
+            {"mg", {dimension_of<mass>, 1e-06, 0.0}},
+            {"ug", {dimension_of<mass>, 1e-09, 0.0}},
+            {"ng", {dimension_of<mass>, 1.0000000000000002e-12, 0.0}},
+            {"pg", {dimension_of<mass>, 1e-15, 0.0}},
+            {"fg", {dimension_of<mass>, 1e-18, 0.0}},
+            {"ag", {dimension_of<mass>, 1.0000000000000001e-21, 0.0}},
+            {"K", {dimension_of<temperature>, 1.0, 0.0}},
+            {"C", {dimension_of<temperature>, 1.0, 273.15}},
+            {"mol", {dimension_of<amount>, 6.02214076e+23, 0.0}},
+            {"things", {dimension_of<amount>, 1.0, 0.0}},
+            {"A", {dimension_of<electric_current>, 1.0, 0.0}},
+            {"PA", {dimension_of<electric_current>, 1000000000000000.0, 0.0}},
+            {"TA", {dimension_of<electric_current>, 1000000000000.0, 0.0}},
+            {"GA", {dimension_of<electric_current>, 1000000000.0, 0.0}},
+            {"MA", {dimension_of<electric_current>, 1000000.0, 0.0}},
+            {"kA", {dimension_of<electric_current>, 1000.0, 0.0}},
+            {"mA", {dimension_of<electric_current>, 0.001, 0.0}},
+            {"uA", {dimension_of<electric_current>, 1e-06, 0.0}},
+            {"nA", {dimension_of<electric_current>, 1e-09, 0.0}},
+            {"pA", {dimension_of<electric_current>, 1e-12, 0.0}},
+            {"fA", {dimension_of<electric_current>, 1e-15, 0.0}},
+            {"aA", {dimension_of<electric_current>, 1e-18, 0.0}},
+            {"cd", {dimension_of<luminous_intensity>, 1.0, 0.0}},
+            {"m2", {dimension_of<area>, 1.0, 0.0}},
+            {"are", {dimension_of<area>, 100.0, 0.0}},
+            {"hectare", {dimension_of<area>, 10000.0, 0.0}},
+            {"km2", {dimension_of<area>, 1000000.0, 0.0}},
+            {"mm2", {dimension_of<area>, 1e-06, 0.0}},
+            {"um2", {dimension_of<area>, 1e-12, 0.0}},
+            {"nm2", {dimension_of<area>, 1e-18, 0.0}},
+            {"mps", {dimension_of<speed>, 1.0, 0.0}},
+            {"kmph", {dimension_of<speed>, 0.2777777777777778, 0.0}},
+            {"mps2", {dimension_of<acceleration>, 1.0, 0.0}},
+            {"G", {dimension_of<acceleration>, 9.80665, 0.0}},
+            {"kgmps", {dimension_of<momentum>, 1.0, 0.0}},
+            {"N", {dimension_of<force>, 1.0, 0.0}},
+            {"PN", {dimension_of<force>, 1000000000000000.0, 0.0}},
+            {"TN", {dimension_of<force>, 1000000000000.0, 0.0}},
+            {"GN", {dimension_of<force>, 1000000000.0, 0.0}},
+            {"MN", {dimension_of<force>, 1000000.0, 0.0}},
+            {"kN", {dimension_of<force>, 1000.0, 0.0}},
+            {"mN", {dimension_of<force>, 0.001, 0.0}},
+            {"uN", {dimension_of<force>, 1e-06, 0.0}},
+            {"nN", {dimension_of<force>, 1e-09, 0.0}},
+            {"pN", {dimension_of<force>, 1e-12, 0.0}},
+            {"fN", {dimension_of<force>, 1e-15, 0.0}},
+            {"aN", {dimension_of<force>, 1e-18, 0.0}},
+            {"J", {dimension_of<energy>, 1.0, 0.0}},
+            {"Nm", {dimension_of<energy>, 1.0, 0.0}},
+            {"eV", {dimension_of<energy>, 1.602176634e-19, 0.0}},
+            {"Wh", {dimension_of<energy>, 3600.0, 0.0}},
+            {"Ws", {dimension_of<energy>, 1.0, 0.0}},
+            {"PJ", {dimension_of<energy>, 1000000000000000.0, 0.0}},
+            {"TJ", {dimension_of<energy>, 1000000000000.0, 0.0}},
+            {"GJ", {dimension_of<energy>, 1000000000.0, 0.0}},
+            {"MJ", {dimension_of<energy>, 1000000.0, 0.0}},
+            {"kJ", {dimension_of<energy>, 1000.0, 0.0}},
+            {"mJ", {dimension_of<energy>, 0.001, 0.0}},
+            {"uJ", {dimension_of<energy>, 1e-06, 0.0}},
+            {"nJ", {dimension_of<energy>, 1e-09, 0.0}},
+            {"pJ", {dimension_of<energy>, 1e-12, 0.0}},
+            {"fJ", {dimension_of<energy>, 1e-15, 0.0}},
+            {"aJ", {dimension_of<energy>, 1e-18, 0.0}},
+            {"GNm", {dimension_of<energy>, 1000000000.0, 0.0}},
+            {"MNm", {dimension_of<energy>, 1000000.0, 0.0}},
+            {"kNm", {dimension_of<energy>, 1000.0, 0.0}},
+            {"mNm", {dimension_of<energy>, 0.001, 0.0}},
+            {"uNm", {dimension_of<energy>, 1e-06, 0.0}},
+            {"PeV", {dimension_of<energy>, 0.0001602176634, 0.0}},
+            {"TeV", {dimension_of<energy>, 1.602176634e-07, 0.0}},
+            {"GeV", {dimension_of<energy>, 1.6021766339999998e-10, 0.0}},
+            {"MeV", {dimension_of<energy>, 1.6021766339999998e-13, 0.0}},
+            {"keV", {dimension_of<energy>, 1.602176634e-16, 0.0}},
+            {"meV", {dimension_of<energy>, 1.6021766339999998e-22, 0.0}},
+            {"ueV", {dimension_of<energy>, 1.602176634e-25, 0.0}},
+            {"PWh", {dimension_of<energy>, 3.6e+18, 0.0}},
+            {"TWh", {dimension_of<energy>, 3600000000000000.0, 0.0}},
+            {"GWh", {dimension_of<energy>, 3600000000000.0, 0.0}},
+            {"MWh", {dimension_of<energy>, 3600000000.0, 0.0}},
+            {"kWh", {dimension_of<energy>, 3600000.0, 0.0}},
+            {"W", {dimension_of<power>, 1.0, 0.0}},
+            {"PW", {dimension_of<power>, 1000000000000000.0, 0.0}},
+            {"TW", {dimension_of<power>, 1000000000000.0, 0.0}},
+            {"GW", {dimension_of<power>, 1000000000.0, 0.0}},
+            {"MW", {dimension_of<power>, 1000000.0, 0.0}},
+            {"kW", {dimension_of<power>, 1000.0, 0.0}},
+            {"mW", {dimension_of<power>, 0.001, 0.0}},
+            {"uW", {dimension_of<power>, 1e-06, 0.0}},
+            {"nW", {dimension_of<power>, 1e-09, 0.0}},
+            {"pW", {dimension_of<power>, 1e-12, 0.0}},
+            {"fW", {dimension_of<power>, 1e-15, 0.0}},
+            {"aW", {dimension_of<power>, 1e-18, 0.0}},
+        };
+
+        // Maps unit symbols to their definition at runtime, e.g. for units that are read from a configuration file.
+        //
+        // The registry starts with the builtin_units and more units can be added at any time, e.g. "mph" for speed.
+        // The symbols are stored in an immutable hash table and readers find a symbol with one atomic load of the current
+        // table and a hash lookup. Around the lookup a reader increments and decrements one of two counters of its stripe,
+        // so lookups are wait-free and never wait for a thread that adds units.
+        // Adding units copies the table, adds the units and publishes the copy (copy on write), writers are serialized by a mutex.
+        // The replaced table is freed as soon as no reader can still search it: the writer switches the readers to the other
+        // counter and waits until the old counters are back to zero (a small RCU with two epochs), so only one table is kept.
+        // A batch without new symbols does not replace the table at all.
+        class unit_registry {
+            // std::hash of the symbol, so std::string_view can be looked up without creating a std::string
+            struct symbol_hash {
+                using is_transparent = void;
+
+                std::size_t operator()(std::string_view symbol) const noexcept { return std::hash<std::string_view>{}(symbol); }
+            };
+            using table = std::unordered_map<std::string, unit_definition, symbol_hash, std::equal_to<>>;
+
+            // the readers of one stripe, count[epoch % 2] is incremented while they search a table
+            struct alignas(cache_line_size) reader_stripe {
+                std::array<std::atomic<std::size_t>, 2> count{};
+            };
+            static constexpr std::size_t reader_stripes = 16;
+
+            std::atomic<const table*>                         current{nullptr};
+            std::unique_ptr<const table>                      current_table;
+            std::mutex                                        writer_mutex;
+            mutable std::atomic<std::size_t>                  epoch{0};
+            mutable std::array<reader_stripe, reader_stripes> readers;
+
+            // the threads are spread over the stripes, so readers on different threads rarely share a counter
+            static std::size_t own_stripe() noexcept {
+                thread_local const auto stripe = std::hash<std::thread::id>{}(std::this_thread::get_id()) % reader_stripes;
+                return stripe;
+            }
+
+            // marks the calling thread as reader while it exists, the table has to be loaded after the guard is created
+            class read_guard {
+                std::atomic<std::size_t>& count;
+
+              public:
+                explicit read_guard(const unit_registry& registry) noexcept
+                    : count{registry.readers[own_stripe()].count[registry.epoch.load(std::memory_order_relaxed) % 2]} {
+                    count.fetch_add(1, std::memory_order_seq_cst);
+                }
+
+                read_guard(const read_guard&)            = delete;
+                read_guard& operator=(const read_guard&) = delete;
+
+                ~read_guard() { count.fetch_sub(1, std::memory_order_release); }
+            };
+
+            // waits until no reader can still search a table that was replaced before the call.
+            // A reader that read the epoch just before the switch can still increment the old counter, it then already finds
+            // the new table. That reader is waited for by the second switch, so the next replaced table is safe as well.
+            void wait_for_readers() const noexcept {
+                for (int i = 0; i < 2; ++i) {
+                    const auto old_parity = epoch.fetch_add(1, std::memory_order_seq_cst) % 2;
+                    for (const auto& stripe : readers) {
+                        while (stripe.count[old_parity].load(std::memory_order_seq_cst) != 0) {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            }
+
+          public:
+            explicit unit_registry(std::span<const named_unit> initial = builtin_units) { add(initial); }
+
+            unit_registry(const unit_registry&)            = delete;
+            unit_registry& operator=(const unit_registry&) = delete;
+
+            // adds all units with one new table, a symbol that is already known has to keep its definition
+            void add(std::span<const named_unit> units) {
+                const std::lock_guard lock{writer_mutex};
+
+                auto updated = current_table != nullptr ? std::make_unique<table>(*current_table) : std::make_unique<table>();
+                bool changed = current_table == nullptr;
+                for (const auto& unit : units) {
+                    if (unit.symbol.empty()) {
+                        throw std::invalid_argument{"a unit symbol can not be empty"};
+                    }
+                    const auto [it, inserted] = updated->try_emplace(std::string{unit.symbol}, unit.definition);
+                    if (!inserted && !(it->second == unit.definition)) {
+                        throw std::invalid_argument{"the unit symbol '" + it->first + "' is already defined differently"};
+                    }
+                    changed = changed || inserted;
+                }
+                if (!changed) {
+                    return;
+                }
+
+                const std::unique_ptr<const table> replaced = std::exchange(current_table, std::move(updated));
+                current.store(current_table.get(), std::memory_order_seq_cst);
+                if (replaced != nullptr) {
+                    wait_for_readers();
+                }
+            }
+
+            void add(std::string_view symbol, const unit_definition& definition) {
+                const named_unit unit{symbol, definition};
+                add(std::span{&unit, 1});
+            }
+
+            // adds symbol with the dimension, multiplier and offset of like, e.g. add("mph", speed{1, 0.44704})
+            template <dimensioned_unit unit_t>
+            void add(std::string_view symbol, const unit_t& like) {
+                add(symbol, unit_definition{dimension_of<unit_t>, like.mult(), like.off()});
+            }
+
+            // the definition of symbol, wait-free
+            [[nodiscard]]
+            std::optional<unit_definition> lookup(std::string_view symbol) const noexcept {
+                const read_guard guard{*this};
+                const auto&      units = *current.load(std::memory_order_seq_cst);
+                const auto  it    = units.find(symbol);
+                return it != units.end() ? std::optional{it->second} : std::nullopt;
+            }
+
+            [[nodiscard]]
+            bool contains(std::string_view symbol) const noexcept {
+                return lookup(symbol).has_value();
+            }
+
+            // the number of known symbols
+            [[nodiscard]]
+            std::size_t size() const noexcept {
+                const read_guard guard{*this};
+                return current.load(std::memory_order_seq_cst)->size();
+            }
+
+            // value in the unit symbol, throws std::invalid_argument if the symbol is unknown or has another dimension
+            template <dimensioned_unit unit_t>
+            [[nodiscard]]
+            unit_t make(unit_base_t<unit_t> value, std::string_view symbol) const {
+                const auto definition = lookup(symbol);
+                if (!definition) {
+                    throw std::invalid_argument{"unknown unit symbol '" + std::string{symbol} + "'"};
+                }
+                if (!(definition->dim == dimension_of<unit_t>)) {
+                    throw std::invalid_argument{"the unit symbol '" + std::string{symbol} + "' has a different dimension"};
+                }
+                return unit_t{value, static_cast<unit_base_t<unit_t>>(definition->mult), static_cast<unit_base_t<unit_t>>(definition->off)};
+            }
+        };
+
+        // the registry of the whole process, created with the builtin_units on first use
+        inline unit_registry& default_unit_registry() {
+            static unit_registry registry;
+            return registry;
+        }
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -78,7 +78,10 @@ namespace sakurajin {
 
             time_si operator-() const;
 
-            void operator=(const time_si& other);
+            time_si& operator=(const time_si& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const time_si& other);
 
             explicit operator long double() const;
 
@@ -206,7 +209,10 @@ namespace sakurajin {
 
             length operator-() const;
 
-            void operator=(const length& other);
+            length& operator=(const length& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const length& other);
 
             explicit operator long double() const;
 
@@ -337,7 +343,10 @@ namespace sakurajin {
 
             mass operator-() const;
 
-            void operator=(const mass& other);
+            mass& operator=(const mass& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const mass& other);
 
             explicit operator long double() const;
 
@@ -455,7 +464,10 @@ namespace sakurajin {
 
             temperature operator-() const;
 
-            void operator=(const temperature& other);
+            temperature& operator=(const temperature& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const temperature& other);
 
             explicit operator long double() const;
 
@@ -546,7 +558,10 @@ namespace sakurajin {
 
             amount operator-() const;
 
-            void operator=(const amount& other);
+            amount& operator=(const amount& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const amount& other);
 
             explicit operator long double() const;
 
@@ -637,7 +652,10 @@ namespace sakurajin {
 
             electric_current operator-() const;
 
-            void operator=(const electric_current& other);
+            electric_current& operator=(const electric_current& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const electric_current& other);
 
             explicit operator long double() const;
 
@@ -762,7 +780,10 @@ namespace sakurajin {
 
             luminous_intensity operator-() const;
 
-            void operator=(const luminous_intensity& other);
+            luminous_intensity& operator=(const luminous_intensity& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const luminous_intensity& other);
 
             explicit operator long double() const;
 
@@ -854,7 +875,10 @@ namespace sakurajin {
 
             energy operator-() const;
 
-            void operator=(const energy& other);
+            energy& operator=(const energy& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const energy& other);
 
             explicit operator long double() const;
 
@@ -1052,7 +1076,10 @@ namespace sakurajin {
 
             power operator-() const;
 
-            void operator=(const power& other);
+            power& operator=(const power& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const power& other);
 
             explicit operator long double() const;
 
@@ -1183,7 +1210,10 @@ namespace sakurajin {
 
             speed operator-() const;
 
-            void operator=(const speed& other);
+            speed& operator=(const speed& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const speed& other);
 
             explicit operator long double() const;
 
@@ -1290,7 +1320,10 @@ namespace sakurajin {
 
             acceleration operator-() const;
 
-            void operator=(const acceleration& other);
+            acceleration& operator=(const acceleration& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const acceleration& other);
 
             explicit operator long double() const;
 
@@ -1389,7 +1422,10 @@ namespace sakurajin {
 
             area operator-() const;
 
-            void operator=(const area& other);
+            area& operator=(const area& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const area& other);
 
             explicit operator long double() const;
 
@@ -1504,7 +1540,10 @@ namespace sakurajin {
 
             force operator-() const;
 
-            void operator=(const force& other);
+            force& operator=(const force& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const force& other);
 
             explicit operator long double() const;
 
@@ -1639,7 +1678,10 @@ namespace sakurajin {
 
             momentum operator-() const;
 
-            void operator=(const momentum& other);
+            momentum& operator=(const momentum& other) = default;
+
+            // sets the value to other converted to the multiplier and offset of this unit, the multiplier and offset stay the same
+            void convert_assign(const momentum& other);
 
             explicit operator long double() const;
 
@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::acceleration::acceleration()
     : acceleration{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::acceleration sakurajin::unit_system::acceleration::opera
     return sakurajin::unit_system::acceleration{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::acceleration operator*(long double scalar, const sakurajin::unit_system::acceleration& val) {
-    return sakurajin::unit_system::acceleration{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::acceleration::operator/(const sakurajin::unit_system::acceleration& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -58,16 +53,12 @@ sakurajin::unit_system::acceleration sakurajin::unit_system::acceleration::opera
 
 sakurajin::unit_system::acceleration
 sakurajin::unit_system::acceleration::operator+(const sakurajin::unit_system::acceleration& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::acceleration
 sakurajin::unit_system::acceleration::operator-(const sakurajin::unit_system::acceleration& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::acceleration sakurajin::unit_system::acceleration::operator-() const {
@@ -88,9 +79,7 @@ sakurajin::unit_system::acceleration sakurajin::unit_system::acceleration::conve
 
 sakurajin::unit_system::acceleration sakurajin::unit_system::acceleration::convert_copy(long double new_multiplier,
                                                                                         long double new_offset) const {
-    auto                                 valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::acceleration retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::acceleration
@@ -101,41 +90,27 @@ sakurajin::unit_system::acceleration::convert_like(const sakurajin::unit_system:
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::acceleration::operator<=>(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::acceleration::operator<(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::acceleration::operator>(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::acceleration::operator<=(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::acceleration::operator>=(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::acceleration::operator==(const sakurajin::unit_system::acceleration& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::acceleration::operator!=(const sakurajin::unit_system::acceleration& other) const {
@@ -152,31 +127,24 @@ void sakurajin::unit_system::acceleration::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::acceleration::operator+=(const sakurajin::unit_system::acceleration& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::acceleration::operator-=(const sakurajin::unit_system::acceleration& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::acceleration::operator=(const sakurajin::unit_system::acceleration& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::acceleration::convert_assign(const sakurajin::unit_system::acceleration& other) {
+    value = detail::value_like(other, *this);
 }
 
 
 sakurajin::unit_system::speed sakurajin::unit_system::acceleration::operator*(const sakurajin::unit_system::time_si& other) const {
-    sakurajin::unit_system::acceleration _v1 = convert_offset(0);
-    sakurajin::unit_system::time_si      _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::speed{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::speed>(*this, other);
 }
 
 sakurajin::unit_system::force sakurajin::unit_system::acceleration::operator*(const sakurajin::unit_system::mass& other) const {
-    sakurajin::unit_system::acceleration _v1 = convert_offset(0);
-    sakurajin::unit_system::mass         _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::force{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::force>(*this, other);
 }
 
 
@@ -196,22 +164,16 @@ sakurajin::unit_system::unit_cast(const sakurajin::unit_system::acceleration& un
 sakurajin::unit_system::acceleration sakurajin::unit_system::clamp(const sakurajin::unit_system::acceleration& unit,
                                                                    const sakurajin::unit_system::acceleration& lower,
                                                                    const sakurajin::unit_system::acceleration& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::acceleration{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::acceleration std::abs(const sakurajin::unit_system::acceleration& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::acceleration& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " metre per second^2";
+    return detail::print(os, t, " metre per second^2");
 }
 
 
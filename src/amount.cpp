@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::amount::amount()
     : amount{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::amount sakurajin::unit_system::amount::operator*(long do
     return sakurajin::unit_system::amount{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::amount operator*(long double scalar, const sakurajin::unit_system::amount& val) {
-    return sakurajin::unit_system::amount{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::amount::operator/(const sakurajin::unit_system::amount& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -57,15 +52,11 @@ sakurajin::unit_system::amount sakurajin::unit_system::amount::operator/(long do
 }
 
 sakurajin::unit_system::amount sakurajin::unit_system::amount::operator+(const sakurajin::unit_system::amount& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::amount sakurajin::unit_system::amount::operator-(const sakurajin::unit_system::amount& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::amount sakurajin::unit_system::amount::operator-() const {
@@ -85,9 +76,7 @@ sakurajin::unit_system::amount sakurajin::unit_system::amount::convert_offset(lo
 }
 
 sakurajin::unit_system::amount sakurajin::unit_system::amount::convert_copy(long double new_multiplier, long double new_offset) const {
-    auto                           valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::amount retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::amount sakurajin::unit_system::amount::convert_like(const sakurajin::unit_system::amount& other) const {
@@ -97,41 +86,27 @@ sakurajin::unit_system::amount sakurajin::unit_system::amount::convert_like(cons
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::amount::operator<=>(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::amount::operator<(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::amount::operator>(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::amount::operator<=(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::amount::operator>=(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::amount::operator==(const sakurajin::unit_system::amount& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::amount::operator!=(const sakurajin::unit_system::amount& other) const {
@@ -148,18 +123,15 @@ void sakurajin::unit_system::amount::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::amount::operator+=(const sakurajin::unit_system::amount& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::amount::operator-=(const sakurajin::unit_system::amount& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::amount::operator=(const sakurajin::unit_system::amount& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::amount::convert_assign(const sakurajin::unit_system::amount& other) {
+    value = detail::value_like(other, *this);
 }
 
 
@@ -178,22 +150,16 @@ sakurajin::unit_system::unit_cast(const sakurajin::unit_system::amount& unit, lo
 sakurajin::unit_system::amount sakurajin::unit_system::clamp(const sakurajin::unit_system::amount& unit,
                                                              const sakurajin::unit_system::amount& lower,
                                                              const sakurajin::unit_system::amount& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::amount{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::amount std::abs(const sakurajin::unit_system::amount& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::amount& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " things";
+    return detail::print(os, t, " things");
 }
 
 
@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::electric_current::electric_current()
     : electric_current{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::electric_current sakurajin::unit_system::electric_curren
     return sakurajin::unit_system::electric_current{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::electric_current operator*(long double scalar, const sakurajin::unit_system::electric_current& val) {
-    return sakurajin::unit_system::electric_current{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::electric_current::operator/(const sakurajin::unit_system::electric_current& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -58,16 +53,12 @@ sakurajin::unit_system::electric_current sakurajin::unit_system::electric_curren
 
 sakurajin::unit_system::electric_current
 sakurajin::unit_system::electric_current::operator+(const sakurajin::unit_system::electric_current& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::electric_current
 sakurajin::unit_system::electric_current::operator-(const sakurajin::unit_system::electric_current& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::electric_current sakurajin::unit_system::electric_current::operator-() const {
@@ -88,9 +79,7 @@ sakurajin::unit_system::electric_current sakurajin::unit_system::electric_curren
 
 sakurajin::unit_system::electric_current sakurajin::unit_system::electric_current::convert_copy(long double new_multiplier,
                                                                                                 long double new_offset) const {
-    auto                                     valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::electric_current retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::electric_current
@@ -101,41 +90,27 @@ sakurajin::unit_system::electric_current::convert_like(const sakurajin::unit_sys
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::electric_current::operator<=>(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::electric_current::operator<(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::electric_current::operator>(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::electric_current::operator<=(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::electric_current::operator>=(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::electric_current::operator==(const sakurajin::unit_system::electric_current& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::electric_current::operator!=(const sakurajin::unit_system::electric_current& other) const {
@@ -152,18 +127,15 @@ void sakurajin::unit_system::electric_current::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::electric_current::operator+=(const sakurajin::unit_system::electric_current& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::electric_current::operator-=(const sakurajin::unit_system::electric_current& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::electric_current::operator=(const sakurajin::unit_system::electric_current& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::electric_current::convert_assign(const sakurajin::unit_system::electric_current& other) {
+    value = detail::value_like(other, *this);
 }
 
 
@@ -184,22 +156,16 @@ sakurajin::unit_system::electric_current sakurajin::unit_system::unit_cast(const
 sakurajin::unit_system::electric_current sakurajin::unit_system::clamp(const sakurajin::unit_system::electric_current& unit,
                                                                        const sakurajin::unit_system::electric_current& lower,
                                                                        const sakurajin::unit_system::electric_current& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::electric_current{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::electric_current std::abs(const sakurajin::unit_system::electric_current& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::electric_current& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " Ampere";
+    return detail::print(os, t, " Ampere");
 }
 
 
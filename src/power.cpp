@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::power::power()
     : power{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::power sakurajin::unit_system::power::operator*(long doub
     return sakurajin::unit_system::power{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::power operator*(long double scalar, const sakurajin::unit_system::power& val) {
-    return sakurajin::unit_system::power{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::power::operator/(const sakurajin::unit_system::power& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -57,15 +52,11 @@ sakurajin::unit_system::power sakurajin::unit_system::power::operator/(long doub
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::power::operator+(const sakurajin::unit_system::power& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::power::operator-(const sakurajin::unit_system::power& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::power::operator-() const {
@@ -85,9 +76,7 @@ sakurajin::unit_system::power sakurajin::unit_system::power::convert_offset(long
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::power::convert_copy(long double new_multiplier, long double new_offset) const {
-    auto                          valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::power retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::power::convert_like(const sakurajin::unit_system::power& other) const {
@@ -97,41 +86,27 @@ sakurajin::unit_system::power sakurajin::unit_system::power::convert_like(const
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::power::operator<=>(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::power::operator<(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::power::operator>(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::power::operator<=(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::power::operator>=(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::power::operator==(const sakurajin::unit_system::power& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::power::operator!=(const sakurajin::unit_system::power& other) const {
@@ -148,38 +123,29 @@ void sakurajin::unit_system::power::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::power::operator+=(const sakurajin::unit_system::power& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::power::operator-=(const sakurajin::unit_system::power& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::power::operator=(const sakurajin::unit_system::power& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::power::convert_assign(const sakurajin::unit_system::power& other) {
+    value = detail::value_like(other, *this);
 }
 
 
 sakurajin::unit_system::speed sakurajin::unit_system::power::operator/(const sakurajin::unit_system::force& other) const {
-    sakurajin::unit_system::power _v1 = convert_offset(0);
-    sakurajin::unit_system::force _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::speed{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+    return detail::divide<sakurajin::unit_system::speed>(*this, other);
 }
 
 sakurajin::unit_system::force sakurajin::unit_system::power::operator/(const sakurajin::unit_system::speed& other) const {
-    sakurajin::unit_system::power _v1 = convert_offset(0);
-    sakurajin::unit_system::speed _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::force{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+    return detail::divide<sakurajin::unit_system::force>(*this, other);
 }
 
 
 sakurajin::unit_system::energy sakurajin::unit_system::power::operator*(const sakurajin::unit_system::time_si& other) const {
-    sakurajin::unit_system::power   _v1 = convert_offset(0);
-    sakurajin::unit_system::time_si _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::energy{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::energy>(*this, other);
 }
 
 
@@ -198,22 +164,16 @@ sakurajin::unit_system::unit_cast(const sakurajin::unit_system::power& unit, lon
 sakurajin::unit_system::power sakurajin::unit_system::clamp(const sakurajin::unit_system::power& unit,
                                                             const sakurajin::unit_system::power& lower,
                                                             const sakurajin::unit_system::power& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::power{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::power std::abs(const sakurajin::unit_system::power& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::power& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " Watt";
+    return detail::print(os, t, " Watt");
 }
 
 
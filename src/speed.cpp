@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::speed::speed()
     : speed{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::speed sakurajin::unit_system::speed::operator*(long doub
     return sakurajin::unit_system::speed{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::speed operator*(long double scalar, const sakurajin::unit_system::speed& val) {
-    return sakurajin::unit_system::speed{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::speed::operator/(const sakurajin::unit_system::speed& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -57,15 +52,11 @@ sakurajin::unit_system::speed sakurajin::unit_system::speed::operator/(long doub
 }
 
 sakurajin::unit_system::speed sakurajin::unit_system::speed::operator+(const sakurajin::unit_system::speed& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::speed sakurajin::unit_system::speed::operator-(const sakurajin::unit_system::speed& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::speed sakurajin::unit_system::speed::operator-() const {
@@ -85,9 +76,7 @@ sakurajin::unit_system::speed sakurajin::unit_system::speed::convert_offset(long
 }
 
 sakurajin::unit_system::speed sakurajin::unit_system::speed::convert_copy(long double new_multiplier, long double new_offset) const {
-    auto                          valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::speed retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::speed sakurajin::unit_system::speed::convert_like(const sakurajin::unit_system::speed& other) const {
@@ -97,41 +86,27 @@ sakurajin::unit_system::speed sakurajin::unit_system::speed::convert_like(const
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::speed::operator<=>(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::speed::operator<(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::speed::operator>(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::speed::operator<=(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::speed::operator>=(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::speed::operator==(const sakurajin::unit_system::speed& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::speed::operator!=(const sakurajin::unit_system::speed& other) const {
@@ -148,56 +123,41 @@ void sakurajin::unit_system::speed::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::speed::operator+=(const sakurajin::unit_system::speed& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::speed::operator-=(const sakurajin::unit_system::speed& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::speed::operator=(const sakurajin::unit_system::speed& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::speed::convert_assign(const sakurajin::unit_system::speed& other) {
+    value = detail::value_like(other, *this);
 }
 
 
 sakurajin::unit_system::time_si sakurajin::unit_system::speed::operator/(const sakurajin::unit_system::acceleration& other) const {
-    sakurajin::unit_system::speed        _v1 = convert_offset(0);
-    sakurajin::unit_system::acceleration _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::time_si{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+    return detail::divide<sakurajin::unit_system::time_si>(*this, other);
 }
 
 sakurajin::unit_system::acceleration sakurajin::unit_system::speed::operator/(const sakurajin::unit_system::time_si& other) const {
-    sakurajin::unit_system::speed   _v1 = convert_offset(0);
-    sakurajin::unit_system::time_si _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::acceleration{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+    return detail::divide<sakurajin::unit_system::acceleration>(*this, other);
 }
 
 
 sakurajin::unit_system::length sakurajin::unit_system::speed::operator*(const sakurajin::unit_system::time_si& other) const {
-    sakurajin::unit_system::speed   _v1 = convert_offset(0);
-    sakurajin::unit_system::time_si _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::length{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::length>(*this, other);
 }
 
 sakurajin::unit_system::energy sakurajin::unit_system::speed::operator*(const sakurajin::unit_system::momentum& other) const {
-    sakurajin::unit_system::speed    _v1 = convert_offset(0);
-    sakurajin::unit_system::momentum _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::energy{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::energy>(*this, other);
 }
 
 sakurajin::unit_system::momentum sakurajin::unit_system::speed::operator*(const sakurajin::unit_system::mass& other) const {
-    sakurajin::unit_system::speed _v1 = convert_offset(0);
-    sakurajin::unit_system::mass  _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::momentum{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::momentum>(*this, other);
 }
 
 sakurajin::unit_system::power sakurajin::unit_system::speed::operator*(const sakurajin::unit_system::force& other) const {
-    sakurajin::unit_system::speed _v1 = convert_offset(0);
-    sakurajin::unit_system::force _v2 = other.convert_offset(0);
-    return sakurajin::unit_system::power{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+    return detail::multiply<sakurajin::unit_system::power>(*this, other);
 }
 
 
@@ -216,22 +176,16 @@ sakurajin::unit_system::unit_cast(const sakurajin::unit_system::speed& unit, lon
 sakurajin::unit_system::speed sakurajin::unit_system::clamp(const sakurajin::unit_system::speed& unit,
                                                             const sakurajin::unit_system::speed& lower,
                                                             const sakurajin::unit_system::speed& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::speed{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::speed std::abs(const sakurajin::unit_system::speed& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::speed& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " metre per second";
+    return detail::print(os, t, " metre per second");
 }
 
 
@@ -1,5 +1,4 @@
-#include "cmath"
-#include "unit_system.hpp"
+#include "unit_impl.hpp"
 
 sakurajin::unit_system::temperature::temperature()
     : temperature{0.0} {}
@@ -44,10 +43,6 @@ sakurajin::unit_system::temperature sakurajin::unit_system::temperature::operato
     return sakurajin::unit_system::temperature{value * scalar, multiplier, offset};
 }
 
-sakurajin::unit_system::temperature operator*(long double scalar, const sakurajin::unit_system::temperature& val) {
-    return sakurajin::unit_system::temperature{val.val() * scalar, val.mult(), val.off()};
-}
-
 long double sakurajin::unit_system::temperature::operator/(const sakurajin::unit_system::temperature& other) const {
     return value / other.convert_like(*this).val();
 }
@@ -57,15 +52,11 @@ sakurajin::unit_system::temperature sakurajin::unit_system::temperature::operato
 }
 
 sakurajin::unit_system::temperature sakurajin::unit_system::temperature::operator+(const sakurajin::unit_system::temperature& other) const {
-    auto retval = convert_like(other);
-    retval.val() += other.val();
-    return retval;
+    return detail::add(*this, other);
 }
 
 sakurajin::unit_system::temperature sakurajin::unit_system::temperature::operator-(const sakurajin::unit_system::temperature& other) const {
-    auto retval = convert_like(other);
-    retval.val() -= other.val();
-    return retval;
+    return detail::subtract(*this, other);
 }
 
 sakurajin::unit_system::temperature sakurajin::unit_system::temperature::operator-() const {
@@ -86,9 +77,7 @@ sakurajin::unit_system::temperature sakurajin::unit_system::temperature::convert
 
 sakurajin::unit_system::temperature sakurajin::unit_system::temperature::convert_copy(long double new_multiplier,
                                                                                       long double new_offset) const {
-    auto                                valBase0 = value * multiplier + offset;
-    sakurajin::unit_system::temperature retval{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
-    return retval;
+    return detail::convert_copy(*this, new_multiplier, new_offset);
 }
 
 sakurajin::unit_system::temperature
@@ -99,41 +88,27 @@ sakurajin::unit_system::temperature::convert_like(const sakurajin::unit_system::
 // comparison operators
 #if __cplusplus >= 202002L
 int sakurajin::unit_system::temperature::operator<=>(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    if (*this < retval) {
-        return -1;
-    }
-
-    if (*this > retval) {
-        return 1;
-    }
-
-    return 0;
+    return detail::compare(*this, other);
 }
 #endif
 bool sakurajin::unit_system::temperature::operator<(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value < retval.val();
+    return value < detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::temperature::operator>(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value > retval.val();
+    return value > detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::temperature::operator<=(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value <= retval.val();
+    return value <= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::temperature::operator>=(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value >= retval.val();
+    return value >= detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::temperature::operator==(const sakurajin::unit_system::temperature& other) const {
-    const auto retval = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    return value == retval.val();
+    return value == detail::value_like(other, *this);
 }
 
 bool sakurajin::unit_system::temperature::operator!=(const sakurajin::unit_system::temperature& other) const {
@@ -150,18 +125,15 @@ void sakurajin::unit_system::temperature::operator/=(long double scalar) {
 }
 
 void sakurajin::unit_system::temperature::operator+=(const sakurajin::unit_system::temperature& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value += otherVal.val();
+    value += detail::value_like(other, *this);
 }
 
 void sakurajin::unit_system::temperature::operator-=(const sakurajin::unit_system::temperature& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value -= otherVal.val();
+    value -= detail::value_like(other, *this);
 }
 
-void sakurajin::unit_system::temperature::operator=(const sakurajin::unit_system::temperature& other) {
-    const auto otherVal = sakurajin::unit_system::unit_cast(other, multiplier, offset);
-    value               = otherVal.val();
+void sakurajin::unit_system::temperature::convert_assign(const sakurajin::unit_system::temperature& other) {
+    value = detail::value_like(other, *this);
 }
 
 
@@ -181,22 +153,16 @@ sakurajin::unit_system::unit_cast(const sakurajin::unit_system::temperature& uni
 sakurajin::unit_system::temperature sakurajin::unit_system::clamp(const sakurajin::unit_system::temperature& unit,
                                                                   const sakurajin::unit_system::temperature& lower,
                                                                   const sakurajin::unit_system::temperature& upper) {
-    auto _lower = unit_cast(lower, unit.mult(), unit.off());
-    auto _upper = unit_cast(upper, unit.mult(), unit.off());
-
-    auto val = unit.val() > _lower.val() ? (unit.val() < _upper.val() ? unit.val() : _upper.val()) : _lower.val();
-    return sakurajin::unit_system::temperature{val, unit.mult(), unit.off()};
+    return detail::clamp(unit, lower, upper);
 }
 
 
 sakurajin::unit_system::temperature std::abs(const sakurajin::unit_system::temperature& unit) {
-    auto inv = -unit;
-    return unit > inv ? unit : inv;
+    return sakurajin::unit_system::detail::abs(unit);
 }
 
 std::ostream& sakurajin::unit_system::operator<<(std::ostream& os, const sakurajin::unit_system::temperature& t) {
-    auto t1 = sakurajin::unit_system::unit_cast(t, 1);
-    return os << t1.val() << " Kelvin";
+    return detail::print(os, t, " Kelvin");
 }
 
 
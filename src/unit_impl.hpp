@@ -0,0 +1,92 @@
+#pragma once
+
+#include "unit_system.hpp"
+
+#include <cmath>
+#include <ostream>
+
+// The implementation all C++17 units share, the files in src only forward to these templates.
+// Every unit has the same layout, so the instantiations compile to the same code and the linker can fold them into one copy.
+namespace sakurajin {
+    namespace unit_system {
+        namespace detail {
+
+            template <class unit_t>
+            unit_t convert_copy(const unit_t& unit, long double new_multiplier, long double new_offset) {
+                auto valBase0 = unit.val() * unit.mult() + unit.off();
+                return unit_t{valBase0 / new_multiplier - new_offset, new_multiplier, new_offset};
+            }
+
+            // the value of other in the multiplier and offset of unit
+            template <class unit_t>
+            long double value_like(const unit_t& other, const unit_t& unit) {
+                return other.convert_copy(unit.mult(), unit.off()).val();
+            }
+
+            // the result has the multiplier and offset of rhs
+            template <class unit_t>
+            unit_t add(const unit_t& lhs, const unit_t& rhs) {
+                auto retval = lhs.convert_like(rhs);
+                retval.val() += rhs.val();
+                return retval;
+            }
+
+            template <class unit_t>
+            unit_t subtract(const unit_t& lhs, const unit_t& rhs) {
+                auto retval = lhs.convert_like(rhs);
+                retval.val() -= rhs.val();
+                return retval;
+            }
+
+            template <class unit_t>
+            int compare(const unit_t& lhs, const unit_t& rhs) {
+                const auto other = value_like(rhs, lhs);
+                if (lhs.val() < other) {
+                    return -1;
+                }
+
+                if (lhs.val() > other) {
+                    return 1;
+                }
+
+                return 0;
+            }
+
+            // products and quotients of two different units are calculated without offsets
+            template <class result_t, class lhs_t, class rhs_t>
+            result_t multiply(const lhs_t& lhs, const rhs_t& rhs) {
+                const auto _v1 = lhs.convert_offset(0);
+                const auto _v2 = rhs.convert_offset(0);
+                return result_t{_v1.val() * _v2.val(), _v1.mult() * _v2.mult()};
+            }
+
+            template <class result_t, class lhs_t, class rhs_t>
+            result_t divide(const lhs_t& lhs, const rhs_t& rhs) {
+                const auto _v1 = lhs.convert_offset(0);
+                const auto _v2 = rhs.convert_offset(0);
+                return result_t{_v1.val() / _v2.val(), _v1.mult() / _v2.mult()};
+            }
+
+            template <class unit_t>
+            unit_t clamp(const unit_t& unit, const unit_t& lower, const unit_t& upper) {
+                const auto _lower = value_like(lower, unit);
+                const auto _upper = value_like(upper, unit);
+
+                auto val = unit.val() > _lower ? (unit.val() < _upper ? unit.val() : _upper) : _lower;
+                return unit_t{val, unit.mult(), unit.off()};
+            }
+
+            template <class unit_t>
+            unit_t abs(const unit_t& unit) {
+                const unit_t inv{-unit.val(), unit.mult(), unit.off()};
+                return unit.val() > value_like(inv, unit) ? unit : inv;
+            }
+
+            template <class unit_t>
+            std::ostream& print(std::ostream& os, const unit_t& unit, const char* name) {
+                return os << unit.convert_copy(1, 0).val() << name;
+            }
+
+        } // namespace detail
+    } // namespace unit_system
+} // namespace sakurajin
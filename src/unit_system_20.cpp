@@ -0,0 +1,64 @@
+#include "unit_system_20.hpp"
+
+// the instantiations the headers declare as extern with UNIT_SYSTEM_EXTERN_TEMPLATES
+namespace sakurajin {
+    namespace unit_system {
+
+        template class time_si_t<float>;
+        template class time_si_t<double>;
+        template class time_si_t<long double>;
+
+        template class length_t<float>;
+        template class length_t<double>;
+        template class length_t<long double>;
+
+        template class mass_t<float>;
+        template class mass_t<double>;
+        template class mass_t<long double>;
+
+        template class temperature_t<float>;
+        template class temperature_t<double>;
+        template class temperature_t<long double>;
+
+        template class amount_t<float>;
+        template class amount_t<double>;
+        template class amount_t<long double>;
+
+        template class electric_current_t<float>;
+        template class electric_current_t<double>;
+        template class electric_current_t<long double>;
+
+        template class luminous_intensity_t<float>;
+        template class luminous_intensity_t<double>;
+        template class luminous_intensity_t<long double>;
+
+        template class energy_t<float>;
+        template class energy_t<double>;
+        template class energy_t<long double>;
+
+        template class power_t<float>;
+        template class power_t<double>;
+        template class power_t<long double>;
+
+        template class speed_t<float>;
+        template class speed_t<double>;
+        template class speed_t<long double>;
+
+        template class acceleration_t<float>;
+        template class acceleration_t<double>;
+        template class acceleration_t<long double>;
+
+        template class area_t<float>;
+        template class area_t<double>;
+        template class area_t<long double>;
+
+        template class force_t<float>;
+        template class force_t<double>;
+        template class force_t<long double>;
+
+        template class momentum_t<float>;
+        template class momentum_t<double>;
+        template class momentum_t<long double>;
+
+    } // namespace unit_system
+} // namespace sakurajin
@@ -0,0 +1,74 @@
+#include "test_functions.hpp"
+
+#include "unit_system/atomic_quantity.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+static_assert(atomic_quantity<energy_t<double>>::is_always_lock_free);
+static_assert(atomic_quantity<amount_t<float>>::is_always_lock_free);
+
+TEST(atomic_quantity_tests, single_thread_test)
+{
+
+    atomic_quantity<energy_t<double>> total { energy_t<double> { 2, 1000 } };
+    EXPECT_TRUE(total.is_lock_free());
+    EXPECT_DOUBLE_EQ(total.load().val(), 2000.0);
+    EXPECT_DOUBLE_EQ(total.load().mult(), 1.0);
+
+    // operands with any multiplier are converted to base units
+    const auto before = total.fetch_add(energy_t<double> { 500, 1 });
+    EXPECT_DOUBLE_EQ(before.val(), 2000.0);
+    EXPECT_DOUBLE_EQ(total.load().val(), 2500.0);
+
+    total.fetch_sub(energy_t<double> { 1, 1000 });
+    EXPECT_DOUBLE_EQ(total.load().val(), 1500.0);
+
+    total += energy_t<double> { 1, 3.6e6 };
+    total -= energy_t<double> { 500, 1 };
+    EXPECT_DOUBLE_EQ(total.load().val(), 3.6e6 + 1000.0);
+
+    const auto old = total.exchange(energy_t<double> { 1, 1 });
+    EXPECT_DOUBLE_EQ(old.val(), 3.6e6 + 1000.0);
+    total.store(energy_t<double> { 3, 1000 });
+    EXPECT_DOUBLE_EQ(total.load().val(), 3000.0);
+}
+
+TEST(atomic_quantity_tests, offset_test)
+{
+
+    // the same rules as operator+=, the offset of the operand is part of its base value
+    atomic_quantity<temperature_t<double>> t;
+    t.fetch_add(temperature_t<double> { 10, 1, 273.15 });
+    EXPECT_DOUBLE_EQ(t.load().val(), 283.15);
+    EXPECT_DOUBLE_EQ(t.load().off(), 0.0);
+}
+
+TEST(atomic_quantity_tests, concurrent_test)
+{
+
+    constexpr int                     threads    = 4;
+    constexpr int                     iterations = 10000;
+    atomic_quantity<energy_t<double>> total;
+    {
+        std::vector<std::jthread> workers;
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back([&total, i] {
+                for (int j = 0; j < iterations; ++j) {
+                    // every thread uses a different multiplier
+                    total.fetch_add(energy_t<double> { 1, i % 2 == 0 ? 1.0 : 1000.0 });
+                }
+            });
+        }
+    }
+    EXPECT_DOUBLE_EQ(total.load().val(), (threads / 2) * iterations * 1.0 + (threads / 2) * iterations * 1000.0);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
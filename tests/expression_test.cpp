@@ -0,0 +1,67 @@
+#include "test_functions.hpp"
+
+#include "unit_system/expression.hpp"
+
+#include <type_traits>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(expression_tests, chain_test)
+{
+
+    const auto m1 = 2_kg;
+    const auto v1 = 36_kmph;
+    const auto v2 = 3_mps;
+    const auto t1 = 500_ms;
+
+    // the result type is the one the normal operators produce
+    const auto expr = lazy(m1) * v1 * v2 / t1;
+    static_assert(std::is_same_v<decltype(expr)::unit_type, power>);
+
+    const power P = expr;
+    EXPECT_UNIT_EQ(P, (m1 * v1) * v2 / t1);
+    EXPECT_UNIT_EQ(P, 120_W);
+    EXPECT_UNIT_EQ(eval(lazy(m1) * v1), m1 * v1);
+
+    // units can start the chain as long as one operand is an expression
+    const energy E = v2 * lazy(m1) * v2 / 2;
+    EXPECT_UNIT_EQ(E, 9_J);
+}
+
+TEST(expression_tests, offset_test)
+{
+
+    // products of two units drop the offset
+    const length  l = 2_m;
+    const auto    T = 20_C;
+    const auto    a = lazy(l) * l;
+    const area    A = a;
+    EXPECT_UNIT_EQ(A, l * l);
+
+    // products with scalars keep it, like the normal operators
+    const temperature doubled = lazy(T) * 2;
+    EXPECT_UNIT_EQ(doubled, T * 2);
+    EXPECT_DOUBLE_EQ(doubled.off(), T.off());
+
+    const temperature halved = lazy(T) / 2.0;
+    EXPECT_UNIT_EQ(halved, T / 2.0);
+}
+
+TEST(expression_tests, ratio_test)
+{
+
+    // the ratio of two values of the same unit is a scalar
+    const auto ratio = (lazy(1_km) / 250_m).eval();
+    EXPECT_DOUBLE_EQ(ratio, 4.0);
+    EXPECT_DOUBLE_EQ((lazy(300_K) / 0_C).eval(), 300_K / 0_C);
+
+    const length scaled = lazy(1_km) / 250_m * 3_m;
+    EXPECT_UNIT_EQ(scaled, 12_m);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
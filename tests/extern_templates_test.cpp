@@ -0,0 +1,35 @@
+#include "test_functions.hpp"
+
+// built with UNIT_SYSTEM_EXTERN_TEMPLATES, the unit classes come from the unit-system library
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(extern_templates_tests, instantiation_test)
+{
+
+    const length_t<float>  a { 2.0f, 1000.0f };
+    const length_t<double> b { 500.0, 1.0 };
+    const length           c = 1.5_km;
+
+    EXPECT_FLOAT_EQ((a + length_t<float> { 1.0f }).convert_copy(1.0f, 0.0f).val(), 2001.0f);
+    EXPECT_DOUBLE_EQ(b.convert_like(length_t<double> { 0.0, 1000.0 }).val(), 0.5);
+    EXPECT_UNIT_EQ(c - 500_m, 1_km);
+    EXPECT_TRUE(c > 1_km);
+}
+
+TEST(extern_templates_tests, operator_test)
+{
+
+    const auto E = 2_N * 3_m;
+    EXPECT_UNIT_EQ(E, 6_J);
+
+    const auto T = 20_C;
+    EXPECT_DOUBLE_EQ(T.convert_offset(0.0).val(), 293.15);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
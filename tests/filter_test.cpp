@@ -0,0 +1,142 @@
+#include "test_functions.hpp"
+
+#include "unit_system/filter.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(filter_tests, threshold_test)
+{
+
+    const auto alarm = above(80.0_C);
+
+    EXPECT_TRUE(alarm(360.0_K));
+    EXPECT_FALSE(alarm(353.0_K));
+    EXPECT_FALSE(alarm(80.0_C));
+    EXPECT_TRUE(at_least(80.0_C)(80.0_C));
+
+    const auto slow = below(3.6_kmph);
+    EXPECT_TRUE(slow(0.5_mps));
+    EXPECT_FALSE(slow(1.1_mps));
+    EXPECT_TRUE(at_most(3.6_kmph)(0.9_mps));
+}
+
+TEST(filter_tests, between_test)
+{
+
+    const auto range = between(1.0_m, 2.0_m);
+
+    EXPECT_TRUE(range(1500.0_mm));
+    EXPECT_TRUE(range(1.0_m));
+    EXPECT_TRUE(range(0.002_km));
+    EXPECT_FALSE(range(2.5_m));
+    EXPECT_FALSE(range(0.5_m));
+
+    const auto tighter = range && above(1.5_m) && at_most(3.0_m);
+    EXPECT_FALSE(tighter(1.5_m));
+    EXPECT_TRUE(tighter(1.6_m));
+    EXPECT_TRUE(tighter(2.0_m));
+    EXPECT_FALSE(tighter(2.1_m));
+}
+
+TEST(filter_tests, raw_column_test)
+{
+
+    // temperatures in degree celsius, stored as raw values
+    std::vector<long double> values;
+    for (int i = 0; i < 130; ++i) {
+        values.push_back(static_cast<long double>(i));
+    }
+
+    const auto celsius = 1.0_C;
+    const auto alarm   = above(80.0_C);
+
+    EXPECT_EQ(alarm.count(values, celsius.mult(), celsius.off()), 49u);
+
+    const auto mask = alarm.bitmask(values, celsius.mult(), celsius.off());
+    ASSERT_EQ(mask.size(), 3u);
+    EXPECT_EQ(mask[0], 0u);
+    EXPECT_EQ(mask[1], ~std::uint64_t{0} << 17);
+    EXPECT_EQ(mask[2], 0x3u);
+
+    const auto idx = between(80.0_C, 82.0_C).indices(values, celsius.mult(), celsius.off());
+    ASSERT_EQ(idx.size(), 3u);
+    EXPECT_EQ(idx[0], 80u);
+    EXPECT_EQ(idx[2], 82u);
+}
+
+TEST(filter_tests, unit_array_test)
+{
+
+    const std::vector<length> values{1_m, 1_km, 500_mm, 2_km, 3000_mm, 20_cm};
+
+    const auto longer = above(1.0_m);
+    EXPECT_EQ(longer.count(values), 3u);
+
+    const auto idx = longer.indices(values);
+    ASSERT_EQ(idx.size(), 3u);
+    EXPECT_EQ(idx[0], 1u);
+    EXPECT_EQ(idx[1], 3u);
+    EXPECT_EQ(idx[2], 4u);
+
+    const auto mask = longer.bitmask(values);
+    ASSERT_EQ(mask.size(), 1u);
+    EXPECT_EQ(mask[0], 0b011010u);
+}
+
+TEST(filter_tests, short_output_test)
+{
+
+    // a bitmask output that is too short only gets the bits of the values that fit into it
+    const std::vector<long double> raw(200, 100.0L);
+    const std::vector<length>      values(200, 2_m);
+    std::vector<std::uint64_t>     words(4, 0xffu);
+
+    const auto longer = above(1.0_m);
+    longer.bitmask(raw, 1.0L, 0.0L, std::span { words }.first(2));
+    EXPECT_EQ(words[0], ~std::uint64_t { 0 });
+    EXPECT_EQ(words[1], ~std::uint64_t { 0 });
+    EXPECT_EQ(words[2], 0xffu);
+
+    words.assign(4, 0xffu);
+    longer.bitmask(values, std::span { words }.first(1));
+    EXPECT_EQ(words[0], ~std::uint64_t { 0 });
+    EXPECT_EQ(words[1], 0xffu);
+
+    longer.bitmask(values, std::span<std::uint64_t> {});
+    EXPECT_EQ(words[2], 0xffu);
+}
+
+TEST(filter_tests, policy_test)
+{
+
+    // chunks that do not line up with the 64 bit words, the results are the same as on the calling thread
+    std::vector<long double> raw;
+    std::vector<length>      values;
+    for (int i = 0; i < 1000; ++i) {
+        raw.push_back(static_cast<long double>((i * 37) % 101));
+        values.emplace_back(raw.back(), i % 2 == 0 ? 1.0 : 0.001);
+    }
+
+    thread_pool pool { 2 };
+    for (const std::size_t grain : { 1u, 100u }) {
+        const parallel_policy policy { &pool, grain };
+        const auto            filter = between(20.0_m, 60.0_m);
+
+        EXPECT_EQ(filter.count(policy, raw, 1.0L, 0.0L), filter.count(raw, 1.0L, 0.0L));
+        EXPECT_EQ(filter.bitmask(policy, raw, 1.0L, 0.0L), filter.bitmask(raw, 1.0L, 0.0L));
+        EXPECT_EQ(filter.indices(policy, raw, 1.0L, 0.0L), filter.indices(raw, 1.0L, 0.0L));
+
+        EXPECT_EQ(filter.count(policy, values), filter.count(values));
+        EXPECT_EQ(filter.bitmask(policy, values), filter.bitmask(values));
+        EXPECT_EQ(filter.indices(policy, values), filter.indices(values));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
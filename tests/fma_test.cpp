@@ -0,0 +1,61 @@
+#include "test_functions.hpp"
+
+#include "unit_system/fma.hpp"
+
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(fma_tests, scalar_test)
+{
+
+    EXPECT_UNIT_EQ(fma(2_kg, 3_mps2, 4_N), 10_N);
+    EXPECT_UNIT_EQ(fma(3_mps2, 2_kg, 4_N), 10_N);
+    EXPECT_UNIT_EQ(fma(2_kW, 1_h, 1_J), 7200001_J);
+
+    // the result keeps the unit of the added value
+    const auto F = fma(2000_g, 3_mps2, 1_kN);
+    EXPECT_DOUBLE_EQ(F.mult(), 1000.0);
+    EXPECT_UNIT_EQ(F, 1006_N);
+
+    // same result as the operators
+    const auto m  = 1.5_kg;
+    const auto a  = 9.81_mps2;
+    const auto F0 = 20_N;
+    EXPECT_UNIT_EQ(fma(m, a, F0), m * a + F0);
+}
+
+TEST(fma_tests, array_test)
+{
+
+    const std::vector<mass>         m { 1_kg, 2_kg, 3000_g };
+    const std::vector<acceleration> a { 1_mps2, 2_mps2, 3_mps2 };
+    std::vector<force>              F { 1_N, 1_N, 1_kN };
+
+    fma(m, a, F);
+    EXPECT_UNIT_EQ(F[0], 2_N);
+    EXPECT_UNIT_EQ(F[1], 5_N);
+    EXPECT_UNIT_EQ(F[2], 1009_N);
+
+    // E += P * dt
+    const std::vector<power> P { 1_W, 1_kW };
+    std::vector<energy>      E { 0_J, 10_J };
+
+    fma(P, 2_s, E);
+    EXPECT_UNIT_EQ(E[0], 2_J);
+    EXPECT_UNIT_EQ(E[1], 2010_J);
+
+    // the same with an execution policy, every element is its own range
+    thread_pool pool { 2 };
+    fma(parallel_policy { &pool, 1 }, m, a, F);
+    EXPECT_UNIT_EQ(F[2], 1018_N);
+    fma(parallel_policy { &pool, 1 }, P, 2_s, E);
+    EXPECT_UNIT_EQ(E[1], 4010_J);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
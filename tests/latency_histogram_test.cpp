@@ -0,0 +1,135 @@
+#include "test_functions.hpp"
+
+#include "unit_system/latency_histogram.hpp"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+// the relative error of the default precision
+constexpr long double histogram_error = 1.0L / 128;
+
+TEST(latency_histogram_tests, percentile_test)
+{
+
+    latency_histogram histogram;
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_DOUBLE_EQ(histogram.percentile(50).val(), 0.0);
+
+    // 1 us to 1000 us, half of them recorded in ns and in ms
+    for (int i = 1; i <= 1000; ++i) {
+        if (i % 2 == 0) {
+            histogram.record(time_si { i * 1000.0L, 1e-9 });
+        } else {
+            histogram.record(time_si { i / 1000.0L, 1e-3 });
+        }
+    }
+    EXPECT_EQ(histogram.count(), 1000u);
+
+    for (const auto percent : { 10.0, 50.0, 90.0, 99.0, 99.9, 100.0 }) {
+        const auto expected = percent * 1e-5L;
+        const auto result   = histogram.percentile(percent);
+        EXPECT_GE(result.val(), expected);
+        EXPECT_LE(result.val(), expected * (1 + histogram_error));
+    }
+
+    EXPECT_NEAR(histogram.min().val(), 1e-6L, 1e-6L * histogram_error);
+    EXPECT_NEAR(histogram.max().val(), 1e-3L, 1e-3L * histogram_error);
+    EXPECT_NEAR(histogram.mean().val(), 500.5e-6L, 500.5e-6L * histogram_error);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0u);
+}
+
+TEST(latency_histogram_tests, small_values_test)
+{
+
+    // below 128 ticks every tick has its own bucket
+    latency_histogram histogram;
+    histogram.record(1_ns);
+    histogram.record(1_us);
+    histogram.record(time_si { 127, 1e-9 }, 3);
+    EXPECT_EQ(histogram.count(), 5u);
+    EXPECT_UNIT_EQ(histogram.min(), 1_ns);
+    EXPECT_UNIT_EQ(histogram.percentile(20), 1_ns);
+    EXPECT_UNIT_EQ(histogram.percentile(80), time_si(127, 1e-9));
+    EXPECT_NEAR(histogram.max().val(), 1e-6L, 1e-6L * histogram_error);
+}
+
+TEST(latency_histogram_tests, range_test)
+{
+
+    // a histogram from 1 us to 1 s
+    latency_histogram histogram { 1_us, 1_s };
+    EXPECT_LT(histogram.buckets(), 2000u);
+
+    // negative durations count as 0, everything too large in the last bucket
+    histogram.record(time_si { -5, 1e-3 });
+    histogram.record(1_ns);
+    histogram.record(10_s);
+    EXPECT_EQ(histogram.count(), 3u);
+    EXPECT_DOUBLE_EQ(histogram.min().val(), 0.0);
+    EXPECT_GE(histogram.max().val(), 1.0);
+    EXPECT_LE(histogram.max().val(), 1.0 + histogram_error);
+
+    EXPECT_THROW(latency_histogram(1_s, 1_us), std::invalid_argument);
+    EXPECT_THROW(latency_histogram(0_s, 1_s), std::invalid_argument);
+    EXPECT_THROW(latency_histogram(time_si { 1, 1e-12 }, 1e9_s), std::invalid_argument);
+}
+
+TEST(latency_histogram_tests, merge_test)
+{
+
+    // every thread records into its own histogram, the report merges them
+    constexpr int                  per_thread = 10000;
+    std::vector<latency_histogram<>> histograms(4);
+    {
+        std::vector<std::jthread> threads;
+        for (std::size_t t = 0; t < histograms.size(); ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < per_thread; ++i) {
+                    histograms[t].record(time_si { static_cast<long double>(t + 1), 1e-3 });
+                }
+            });
+        }
+    }
+
+    latency_histogram total;
+    for (const auto& histogram : histograms) {
+        total.merge(histogram);
+    }
+    EXPECT_EQ(total.count(), 4u * per_thread);
+    EXPECT_NEAR(total.percentile(25).val(), 1e-3L, 1e-3L * histogram_error);
+    EXPECT_NEAR(total.percentile(50).val(), 2e-3L, 2e-3L * histogram_error);
+    EXPECT_NEAR(total.percentile(100).val(), 4e-3L, 4e-3L * histogram_error);
+
+    latency_histogram other { 1_us, 1_s };
+    EXPECT_THROW(total.merge(other), std::invalid_argument);
+}
+
+TEST(latency_histogram_tests, concurrent_test)
+{
+
+    // all threads record into the same histogram without losing counts
+    constexpr int             per_thread = 50000;
+    latency_histogram         histogram;
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < per_thread; ++i) {
+                histogram.record(time_si { static_cast<long double>(i % 100), 1e-6 });
+            }
+        });
+    }
+    threads.clear();
+    EXPECT_EQ(histogram.count(), 4u * per_thread);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,68 @@
+#include "test_functions.hpp"
+
+#include "unit_system/latest_value.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+// every cell has its own cache lines
+static_assert(alignof(latest_value<speed_t<double>>) == cache_line_size);
+static_assert(sizeof(latest_value<speed_t<double>>) == cache_line_size);
+static_assert(sizeof(latest_value<speed>) % cache_line_size == 0);
+
+TEST(latest_value_tests, single_thread_test)
+{
+
+    latest_value<temperature> cell { 20_C };
+    EXPECT_UNIT_EQ(cell.load(), 20_C);
+    EXPECT_DOUBLE_EQ(cell.load().off(), 273.15);
+    EXPECT_EQ(cell.version(), 0u);
+
+    // the multiplier and offset are stored with the value
+    cell.store(300_K);
+    EXPECT_EQ(cell.version(), 1u);
+    const auto value = cell.load();
+    EXPECT_DOUBLE_EQ(value.val(), 300.0);
+    EXPECT_DOUBLE_EQ(value.off(), 0.0);
+}
+
+TEST(latest_value_tests, concurrent_test)
+{
+
+    // the value, multiplier and offset of every store belong together, readers must never see a mix of two stores
+    constexpr int             stores = 200000;
+    latest_value<power>       cell { power { 0, 1, 0 } };
+    std::atomic<bool>         done { false };
+    std::atomic<int>          torn { 0 };
+    std::vector<std::jthread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                const auto value = cell.load();
+                if (value.mult() != value.val() + 1 || value.off() != 2 * value.val()) {
+                    torn.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (int i = 1; i <= stores; ++i) {
+        cell.store(power { static_cast<long double>(i), static_cast<long double>(i + 1), static_cast<long double>(2 * i) });
+    }
+    done = true;
+    readers.clear();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(cell.version(), static_cast<std::uint64_t>(stores));
+    EXPECT_DOUBLE_EQ(cell.load().val(), stores);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
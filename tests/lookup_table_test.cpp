@@ -0,0 +1,136 @@
+#include "test_functions.hpp"
+
+#include "unit_system/lookup_table.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(lookup_table_tests, linear_test)
+{
+
+    // a spring with 2 N per mm, sampled in mm
+    const std::vector<length> x { 0_mm, 10_mm, 20_mm, 30_mm };
+    const std::vector<force>  y { 0_N, 20_N, 40_N, 60_N };
+
+    const lookup_table<length, force> spring { x, y };
+    EXPECT_TRUE(spring.is_uniform());
+
+    EXPECT_UNIT_EQ(spring(15_mm), 30_N);
+    EXPECT_UNIT_EQ(spring(0.025_m), 50_N);
+
+    // outside of the samples the first and last value are used
+    EXPECT_UNIT_EQ(spring(-5_mm), 0_N);
+    EXPECT_UNIT_EQ(spring(1_m), 60_N);
+}
+
+TEST(lookup_table_tests, non_uniform_test)
+{
+
+    // unsorted samples of a fan curve
+    const std::vector<speed> x { 10_mps, 1_mps, 2_mps, 5_mps, 3_mps };
+    const std::vector<power> y { 1000_W, 1_W, 8_W, 125_W, 27_W };
+
+    const lookup_table<speed, power> fan { x, y };
+    EXPECT_FALSE(fan.is_uniform());
+    EXPECT_EQ(fan.size(), 5u);
+
+    EXPECT_UNIT_EQ(fan(1.5_mps), 4.5_W);
+    EXPECT_UNIT_EQ(fan(4_mps), 76_W);
+    EXPECT_UNIT_EQ(fan(7.5_mps), 562.5_W);
+    EXPECT_UNIT_EQ(fan(10_mps), 1000_W);
+
+    const std::vector<speed> inputs { 1_mps, 2.5_mps, 36_kmph, 18_kmph };
+    const auto               outputs = fan.evaluate(inputs);
+    ASSERT_EQ(outputs.size(), 4u);
+    EXPECT_UNIT_EQ(outputs[0], 1_W);
+    EXPECT_UNIT_EQ(outputs[1], 17.5_W);
+    EXPECT_NEAR(outputs[2].val(), 1000.0, 1e-9);
+    EXPECT_NEAR(outputs[3].val(), 125.0, 1e-9);
+}
+
+TEST(lookup_table_tests, cubic_test)
+{
+
+    // the area of a square, interior segments reproduce quadratic curves exactly
+    std::vector<length> x;
+    std::vector<area>   y;
+    for (int i = 0; i <= 10; ++i) {
+        x.emplace_back(i);
+        y.emplace_back(i * i);
+    }
+
+    const lookup_table<length, area> square_area { x, y, interpolation::cubic };
+    EXPECT_EQ(square_area.interpolation_mode(), interpolation::cubic);
+
+    EXPECT_NEAR(square_area(2.5_m).val(), 6.25, 1e-12);
+    EXPECT_NEAR(square_area(7.25_m).val(), 52.5625, 1e-12);
+    EXPECT_NEAR(square_area(5_m).val(), 25.0, 1e-12);
+}
+
+TEST(lookup_table_tests, nan_test)
+{
+
+    // NaN is neither clamped nor searched, it stays NaN on the uniform and the eytzinger path
+    const std::vector<length> uniform_x { 0_mm, 10_mm, 20_mm };
+    const std::vector<length> other_x { 0_mm, 1_mm, 20_mm };
+    const std::vector<force>  y { 0_N, 20_N, 40_N };
+    const auto                nan = std::numeric_limits<long double>::quiet_NaN();
+
+    const lookup_table<length, force> uniform { uniform_x, y };
+    const lookup_table<length, force> non_uniform { other_x, y, interpolation::cubic };
+    ASSERT_TRUE(uniform.is_uniform());
+    ASSERT_FALSE(non_uniform.is_uniform());
+    EXPECT_TRUE(std::isnan(uniform(length { nan, 1, 0 }).val()));
+    EXPECT_TRUE(std::isnan(non_uniform(length { nan, 1, 0 }).val()));
+
+    const std::vector<length> inputs { 5_mm, length { nan, 1, 0 } };
+    const auto                outputs = uniform.evaluate(inputs);
+    EXPECT_UNIT_EQ(outputs[0], 10_N);
+    EXPECT_TRUE(std::isnan(outputs[1].val()));
+}
+
+TEST(lookup_table_tests, policy_test)
+{
+
+    std::vector<length> x;
+    std::vector<force>  y;
+    for (int i = 0; i < 50; ++i) {
+        x.emplace_back(i * i, 0.001);
+        y.emplace_back(i, 1);
+    }
+    const lookup_table<length, force> table { x, y };
+
+    std::vector<length> inputs;
+    for (int i = 0; i < 1000; ++i) {
+        inputs.emplace_back(i * 2.5, 0.001);
+    }
+
+    thread_pool pool { 2 };
+    const auto  expected = table.evaluate(inputs);
+    const auto  results  = table.evaluate(parallel_policy { &pool, 1 }, inputs);
+    ASSERT_EQ(results.size(), expected.size());
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].val(), expected[i].val());
+    }
+}
+
+TEST(lookup_table_tests, invalid_test)
+{
+
+    const std::vector<length> x { 1_m, 1_m };
+    const std::vector<force>  y { 1_N, 2_N };
+    EXPECT_THROW((lookup_table<length, force> { x, y }), std::invalid_argument);
+
+    const std::vector<force> too_short { 1_N };
+    EXPECT_THROW((lookup_table<length, force> { x, too_short }), std::invalid_argument);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,36 @@
+// gcc 12 can not mix textual includes of the standard library with an imported module that uses the same templates
+// (it runs into an internal compiler error), so this test only imports the module and does not use gtest.
+import sakurajin.unit_system;
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+namespace {
+    int failures = 0;
+
+    void expect_near(long double actual, long double expected, const char* name) {
+        const auto diff = actual > expected ? actual - expected : expected - actual;
+        if (diff > 1e-9L * (expected < 0 ? -expected : expected) + 1e-12L) {
+            __builtin_printf("%s failed: %Lf != %Lf\n", name, actual, expected);
+            ++failures;
+        }
+    }
+} // namespace
+
+int main() {
+    const length l = 5_km;
+    expect_near(l.convert_copy(1.0, 0.0).val(), 5000.0L, "literal");
+
+    const auto T = 20_C;
+    expect_near(T.convert_copy(1.0, 0.0).val(), 293.15L, "temperature literal");
+
+    const auto  P        = (2_kg * 3_mps) * 2_mps / 1_s;
+    const power expected = 12_W;
+    expect_near(P.val(), expected.convert_like(P).val(), "cross unit operators");
+
+    const length_t<double> x{2.0, 1000.0};
+    const auto             A = x * x;
+    expect_near(A.convert_copy(1.0, 0.0).val(), 4e6L, "double units");
+
+    return failures == 0 ? 0 : 1;
+}
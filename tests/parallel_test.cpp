@@ -0,0 +1,108 @@
+#include "test_functions.hpp"
+
+#include "unit_system/parallel.hpp"
+
+#include <atomic>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(parallel_tests, parallel_for_test)
+{
+
+    // every index is visited exactly once, for pools with and without workers
+    for (const std::size_t workers : { 0, 1, 3 }) {
+        thread_pool pool { workers };
+        EXPECT_EQ(pool.worker_count(), workers);
+
+        std::vector<std::atomic<int>> visits(100000);
+        std::atomic<std::size_t>      largest { 0 };
+        pool.parallel_for(visits.size(), 1000, [&](std::size_t begin, std::size_t end) {
+            for (auto i = begin; i < end; ++i) {
+                visits[i].fetch_add(1, std::memory_order_relaxed);
+            }
+            std::size_t seen = largest.load();
+            while (end - begin > seen && !largest.compare_exchange_weak(seen, end - begin)) {
+            }
+        });
+        for (const auto& visit : visits) {
+            ASSERT_EQ(visit.load(), 1);
+        }
+        // the ranges are split down to the grain size
+        if (workers > 0) {
+            EXPECT_LE(largest.load(), 1000u);
+        }
+    }
+}
+
+TEST(parallel_tests, nested_test)
+{
+
+    // a parallel_for inside a worker uses the queue of that worker
+    thread_pool      pool { 2 };
+    std::atomic<int> sum { 0 };
+    pool.parallel_for(8, 1, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            pool.parallel_for(100, 10, [&](std::size_t inner_begin, std::size_t inner_end) {
+                sum.fetch_add(static_cast<int>(inner_end - inner_begin));
+            });
+        }
+    });
+    EXPECT_EQ(sum.load(), 800);
+}
+
+TEST(parallel_tests, algorithms_test)
+{
+
+    constexpr std::size_t count = 50000;
+    std::vector<force>    forces;
+    std::vector<length>   lengths;
+    for (std::size_t i = 0; i < count; ++i) {
+        forces.emplace_back(static_cast<long double>(i % 13), i % 2 == 0 ? 1.0 : 1000.0);
+        lengths.emplace_back(static_cast<long double>(i % 7), i % 3 == 0 ? 1.0 : 0.001);
+    }
+
+    thread_pool           pool { 3 };
+    const parallel_policy policy { &pool, 1024 };
+
+    // force * length -> energy, the same with both policies
+    std::vector<energy> seq_energy(count);
+    std::vector<energy> par_energy(count);
+    multiply(seq, forces, lengths, seq_energy);
+    multiply(policy, forces, lengths, par_energy);
+    for (std::size_t i = 0; i < count; i += 101) {
+        EXPECT_UNIT_EQ(par_energy[i], forces[i] * lengths[i]);
+        EXPECT_UNIT_EQ(par_energy[i], seq_energy[i]);
+    }
+
+    // every value gets the multiplier of like
+    std::vector<length> in_mm(count);
+    convert(policy, lengths, in_mm, 0_mm);
+    for (std::size_t i = 0; i < count; i += 101) {
+        EXPECT_DOUBLE_EQ(in_mm[i].mult(), 0.001);
+        EXPECT_UNIT_EQ(in_mm[i], lengths[i]);
+    }
+
+    // the partial sums do not depend on the number of threads
+    const auto seq_sum = reduce(parallel_policy { nullptr, 1024 }, lengths);
+    const auto par_sum = reduce(policy, lengths);
+    EXPECT_EQ(seq_sum.val(), par_sum.val());
+    long double expected = 0;
+    for (const auto& l : lengths) {
+        expected += l.val() * l.mult();
+    }
+    EXPECT_NEAR(par_sum.val(), expected, 1e-9);
+    EXPECT_UNIT_EQ(reduce(seq, std::vector<length> {}), 0_m);
+
+    clamp(policy, lengths, 1_mm, 3_m);
+    for (const auto& l : lengths) {
+        EXPECT_TRUE(l >= 1_mm && l <= 3_m);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
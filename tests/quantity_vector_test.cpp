@@ -0,0 +1,98 @@
+#include "test_functions.hpp"
+
+#include "unit_system/quantity_vector.hpp"
+
+#include <type_traits>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(quantity_vector_tests, storage_test)
+{
+
+    // everything is stored in the unit of the first element
+    const std::vector<length> lengths { 1_km, 20_m, 3_km };
+    quantity_vector<length>   vec { lengths };
+    EXPECT_EQ(vec.size(), 3u);
+    EXPECT_DOUBLE_EQ(vec.mult(), 1000.0);
+    EXPECT_DOUBLE_EQ(vec.values()[1], 0.02);
+    EXPECT_UNIT_EQ(vec[1], 20_m);
+
+    vec.push_back(500_m);
+    vec.set(0, 2_m);
+    vec.convert(1.0, 0.0);
+    EXPECT_DOUBLE_EQ(vec.mult(), 1.0);
+
+    const auto units = vec.to_vector();
+    ASSERT_EQ(units.size(), 4u);
+    EXPECT_UNIT_EQ(units[0], 2_m);
+    EXPECT_UNIT_EQ(units[2], 3_km);
+    EXPECT_UNIT_EQ(units[3], 500_m);
+}
+
+TEST(quantity_vector_tests, fused_expression_test)
+{
+
+    std::vector<mass>  masses;
+    std::vector<speed> speeds;
+    for (int i = 0; i < 10000; ++i) {
+        masses.emplace_back(i % 7 + 1);
+        speeds.emplace_back(i % 11, 1.0 / 3.6);
+    }
+    const quantity_vector<mass>  m { masses };
+    const quantity_vector<speed> v { speeds };
+
+    // the result unit is checked at compile time
+    const auto expr = 0.5 * m * v * v;
+    static_assert(std::is_same_v<decltype(expr)::unit_type, energy>);
+
+    const quantity_vector<energy> E = expr;
+    ASSERT_EQ(E.size(), masses.size());
+    for (std::size_t i = 0; i < E.size(); ++i) {
+        EXPECT_NEAR(E[i].convert_like(1_J).val(), (0.5 * masses[i] * speeds[i] * speeds[i]).convert_like(1_J).val(), 1e-9);
+    }
+
+    // assigning converts into the unit the vector already has, also with several threads
+    thread_pool             pool { 3 };
+    quantity_vector<energy> E_kJ(masses.size(), 0_kJ);
+    E_kJ.assign(expr, parallel_policy { &pool, 4096 });
+    EXPECT_DOUBLE_EQ(E_kJ.mult(), 1000.0);
+    for (std::size_t i = 0; i < E.size(); i += 97) {
+        EXPECT_NEAR(E_kJ[i].convert_like(1_J).val(), E[i].val() * E.mult(), 1e-9);
+    }
+
+    // or evaluated into a new vector
+    const quantity_vector<energy> E_pool { expr, parallel_policy { &pool, 4096 } };
+    for (std::size_t i = 0; i < E.size(); i += 97) {
+        EXPECT_DOUBLE_EQ(E_pool[i].val(), E[i].val());
+    }
+
+    EXPECT_THROW((void)(m * quantity_vector<speed>(3)), std::invalid_argument);
+}
+
+TEST(quantity_vector_tests, offset_test)
+{
+
+    const std::vector<temperature> temperatures { 20_C, 30_C, 40_C };
+    quantity_vector<temperature>   T { temperatures };
+
+    // scalar products keep the offset like the normal operators
+    const quantity_vector<temperature> doubled = T * 2;
+    EXPECT_UNIT_EQ(doubled[1], 30_C * 2);
+
+    // the ratio of two vectors of the same unit
+    const quantity_vector<length> l { std::vector<length> { 1_m, 2_m, 3_m } };
+    const quantity_vector<length> scaled = l / l * 5_mm;
+    EXPECT_UNIT_EQ(scaled[2], 5_mm);
+
+    // the expression can read the vector it is assigned to
+    T = T / 2.0;
+    EXPECT_UNIT_EQ(T[2], 40_C / 2.0);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
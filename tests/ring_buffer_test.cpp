@@ -0,0 +1,151 @@
+#include "test_functions.hpp"
+
+#include "unit_system/ring_buffer.hpp"
+
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+template <class queue_t>
+void check_single_thread() {
+    // the queue stores mA, every unit is converted to that
+    queue_t queue { 3, electric_current_t<double> { 0, 0.001 } };
+    EXPECT_EQ(queue.capacity(), 4u);
+    EXPECT_DOUBLE_EQ(queue.mult(), 0.001);
+    EXPECT_FALSE(queue.pop().has_value());
+
+    EXPECT_TRUE(queue.push(electric_current_t<double> { 2, 1 }));
+    const auto first = queue.pop();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_DOUBLE_EQ(first->val(), 2000.0);
+    EXPECT_DOUBLE_EQ(first->mult(), 0.001);
+
+    // a batch only pushes what fits
+    const std::array<electric_current_t<double>, 6> in {
+        electric_current_t<double> { 1, 1 },
+        electric_current_t<double> { 2, 0.001 },
+        electric_current_t<double> { 3, 1 },
+        electric_current_t<double> { 4, 1 },
+        electric_current_t<double> { 5, 1 },
+        electric_current_t<double> { 6, 1 },
+    };
+    EXPECT_EQ(queue.push(in), 4u);
+    EXPECT_EQ(queue.size(), 4u);
+    EXPECT_FALSE(queue.push(in[5]));
+
+    std::array<electric_current_t<double>, 3> out;
+    EXPECT_EQ(queue.pop(out), 3u);
+    EXPECT_UNIT_EQ(out[0], in[0]);
+    EXPECT_UNIT_EQ(out[1], in[1]);
+    EXPECT_UNIT_EQ(out[2], in[2]);
+
+    // raw values use the multiplier of the queue
+    const std::array<double, 2> raw_in { 5000, 6000 };
+    EXPECT_EQ(queue.push_values(raw_in), 2u);
+    std::array<double, 4> raw_out {};
+    EXPECT_EQ(queue.pop_values(raw_out), 3u);
+    EXPECT_DOUBLE_EQ(raw_out[0], 4000.0);
+    EXPECT_DOUBLE_EQ(raw_out[1], 5000.0);
+    EXPECT_DOUBLE_EQ(raw_out[2], 6000.0);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST(ring_buffer_tests, spsc_single_thread_test)
+{
+    check_single_thread<spsc_queue<electric_current_t<double>>>();
+}
+
+TEST(ring_buffer_tests, mpsc_single_thread_test)
+{
+    check_single_thread<mpsc_queue<electric_current_t<double>>>();
+}
+
+TEST(ring_buffer_tests, offset_test)
+{
+
+    // a queue in degrees Celsius
+    spsc_queue<temperature_t<double>> queue { 8, temperature_t<double> { 0, 1, 273.15 } };
+    queue.push(temperature_t<double> { 300 });
+    std::array<double, 1> raw {};
+    queue.pop_values(raw);
+    EXPECT_NEAR(raw[0], 26.85, 1e-9);
+}
+
+TEST(ring_buffer_tests, spsc_concurrent_test)
+{
+
+    constexpr std::size_t       count = 100000;
+    spsc_queue<power_t<double>> queue { 64 };
+    std::jthread                producer { [&queue] {
+        std::array<power_t<double>, 16> batch;
+        for (std::size_t i = 0; i < count;) {
+            const auto n = std::min(batch.size(), count - i);
+            for (std::size_t j = 0; j < n; ++j) {
+                batch[j] = power_t<double> { static_cast<double>(i + j) };
+            }
+            std::size_t pushed = 0;
+            while (pushed < n) {
+                pushed += queue.push(std::span { batch }.subspan(pushed, n - pushed));
+                std::this_thread::yield();
+            }
+            i += n;
+        }
+    } };
+
+    // the values arrive in order, a failed check must not stop the loop or the producer never finishes
+    std::size_t next = 0;
+    while (next < count) {
+        if (const auto value = queue.pop()) {
+            EXPECT_DOUBLE_EQ(value->val(), static_cast<double>(next));
+            ++next;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+TEST(ring_buffer_tests, mpsc_concurrent_test)
+{
+
+    constexpr std::size_t       producers = 4;
+    constexpr std::size_t       count     = 20000;
+    mpsc_queue<power_t<double>> queue { 64 };
+    std::vector<std::jthread>   workers;
+    for (std::size_t p = 0; p < producers; ++p) {
+        workers.emplace_back([&queue, p] {
+            for (std::size_t i = 0; i < count; ++i) {
+                // the value encodes the producer and its sequence number
+                while (!queue.push(power_t<double> { static_cast<double>(i * producers + p) })) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // every producer's values arrive in the order it pushed them
+    std::array<std::size_t, producers> next {};
+    std::size_t                        received = 0;
+    std::array<double, 32>             out {};
+    while (received < producers * count) {
+        const auto n = queue.pop_values(out);
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto value    = static_cast<std::size_t>(out[i]);
+            const auto producer = value % producers;
+            EXPECT_EQ(value / producers, next[producer]);
+            ++next[producer];
+        }
+        received += n;
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
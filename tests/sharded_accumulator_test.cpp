@@ -0,0 +1,106 @@
+#include "test_functions.hpp"
+
+#include "unit_system/sharded_accumulator.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+
+static_assert(alignof(std::atomic<double>) <= cache_line_size);
+
+TEST(sharded_accumulator_tests, single_thread_test)
+{
+
+    sharded_accumulator<time_si_t<double>> total { 3 };
+    EXPECT_EQ(total.shard_count(), 3u);
+
+    // every shard converts its operands to base units
+    total.add(0, time_si_t<double> { 1, 60 });
+    total.add(1, time_si_t<double> { 30, 1 });
+    total.add(1, time_si_t<double> { 500, 0.001 });
+    EXPECT_DOUBLE_EQ(total.load(0).val(), 60.0);
+    EXPECT_DOUBLE_EQ(total.load(1).val(), 30.5);
+    EXPECT_DOUBLE_EQ(total.load(2).val(), 0.0);
+    EXPECT_DOUBLE_EQ(total.load().val(), 90.5);
+    EXPECT_DOUBLE_EQ(total.load().mult(), 1.0);
+
+    total.reset();
+    EXPECT_DOUBLE_EQ(total.load().val(), 0.0);
+
+    // a shard count of 0 still creates one shard
+    sharded_accumulator<time_si_t<double>> single { 0 };
+    EXPECT_EQ(single.shard_count(), 1u);
+}
+
+TEST(sharded_accumulator_tests, compensated_test)
+{
+
+    // 1 J is below the precision of a double at 1e16 J, so plain additions lose all of them
+    sharded_accumulator<energy_t<double>>                         plain { 2 };
+    sharded_accumulator<energy_t<double>, summation::compensated> compensated { 2 };
+    plain.add(0, energy_t<double> { 1e16 });
+    compensated.add(0, energy_t<double> { 1e16 });
+    for (int i = 0; i < 1000; ++i) {
+        plain.add(i % 2, energy_t<double> { 1 });
+        compensated.add(0, energy_t<double> { 1 });
+        compensated.add(1, energy_t<double> { 1, 1e-3 });
+    }
+    EXPECT_DOUBLE_EQ(plain.load(0).val(), 1e16);
+    EXPECT_DOUBLE_EQ(compensated.load(0).val(), 1e16 + 1000.0);
+    EXPECT_DOUBLE_EQ(compensated.load().val(), 1e16 + 1001.0);
+}
+
+TEST(sharded_accumulator_tests, concurrent_test)
+{
+
+    constexpr unsigned                    threads    = 4;
+    constexpr int                         iterations = 10000;
+    sharded_accumulator<energy_t<double>> total { threads };
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back([&total, i] {
+                for (int j = 0; j < iterations; ++j) {
+                    total.add(i, energy_t<double> { 1, i % 2 == 0 ? 1.0 : 1000.0 });
+                }
+            });
+        }
+        // reading while the workers add is allowed
+        EXPECT_LE(total.load().val(), (threads / 2) * iterations * 1001.0);
+    }
+    EXPECT_DOUBLE_EQ(total.load().val(), (threads / 2) * iterations * 1001.0);
+}
+
+TEST(sharded_accumulator_tests, shared_shard_test)
+{
+
+    // more threads than shards, the threads that do not own a shard still add exactly
+    constexpr unsigned                                            threads    = 4;
+    constexpr int                                                 iterations = 10000;
+    sharded_accumulator<energy_t<double>>                         plain { 1 };
+    sharded_accumulator<energy_t<double>, summation::compensated> compensated { 3 };
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back([&] {
+                for (int j = 0; j < iterations; ++j) {
+                    plain.add(0, energy_t<double> { 1 });
+                    compensated.add(energy_t<double> { 1, 1000 });
+                    if (j % 64 == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+    EXPECT_DOUBLE_EQ(plain.load().val(), threads * iterations);
+    EXPECT_DOUBLE_EQ(plain.load(0).val(), threads * iterations);
+    EXPECT_DOUBLE_EQ(compensated.load().val(), threads * iterations * 1000.0);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,157 @@
+#include "test_functions.hpp"
+
+#include "unit_system/shm_channel.hpp"
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace sakurajin::unit_system;
+
+static_assert(dimension_of<force_t<double>> == dimension { -2, 1, 1, 0, 0, 0, 0 });
+static_assert(dimension_of<energy> == dimension { -2, 2, 1, 0, 0, 0, 0 });
+static_assert(dimensioned_unit<power_t<float>>);
+
+// a name that is unique for this process and test
+std::string channel_name(const std::string& test) {
+    return "/unit_system_" + test + "_" + std::to_string(::getpid());
+}
+
+TEST(shm_channel_tests, header_test)
+{
+
+    const auto                             name = channel_name("header");
+    shm_writer<electric_current_t<double>> writer { name, 100, electric_current_t<double> { 0, 0.001 } };
+    EXPECT_EQ(writer.capacity(), 128u);
+
+    // the reader gets the multiplier from the header
+    shm_reader<electric_current_t<double>> reader { name };
+    EXPECT_EQ(reader.capacity(), 128u);
+    EXPECT_DOUBLE_EQ(reader.mult(), 0.001);
+
+    // units of another dimension or base type are rejected
+    EXPECT_THROW(shm_reader<length_t<double>> { name }, std::invalid_argument);
+    EXPECT_THROW(shm_reader<electric_current_t<float>> { name }, std::invalid_argument);
+    EXPECT_THROW(shm_reader<electric_current_t<double>> { channel_name("missing") }, std::system_error);
+}
+
+TEST(shm_channel_tests, existing_test)
+{
+
+    // a second writer can not take over a live channel
+    const auto                  name = channel_name("existing");
+    shm_writer<power_t<double>> writer { name, 4 };
+    try {
+        shm_writer<power_t<double>> second { name, 4 };
+        ADD_FAILURE() << "the second writer did not throw";
+    } catch (const std::system_error& error) {
+        EXPECT_EQ(error.code(), std::errc::file_exists);
+    }
+
+    // the first writer still owns the channel
+    shm_reader<power_t<double>> reader { name };
+    const std::array<double, 1> value { 5 };
+    EXPECT_EQ(writer.write_values(value), 1u);
+    EXPECT_EQ(reader.peek().size(), 1u);
+
+    // replacing is explicit, e.g. after a crashed writer left the object behind
+    shm_writer<power_t<double>> replacement { name, 8, power_t<double> { 0, 1 }, shm_existing::replace };
+    EXPECT_EQ(shm_reader<power_t<double>> { name }.capacity(), 8u);
+}
+
+TEST(shm_channel_tests, zero_copy_test)
+{
+
+    const auto                  name = channel_name("zero_copy");
+    shm_writer<power_t<double>> writer { name, 4 };
+    shm_reader<power_t<double>> reader { name };
+    EXPECT_TRUE(reader.peek().empty());
+
+    const std::array<power_t<double>, 3> in { power_t<double> { 1 }, power_t<double> { 2, 1000 }, power_t<double> { 3 } };
+    EXPECT_EQ(writer.write(in), 3u);
+    EXPECT_EQ(writer.write(in), 1u);
+
+    // the values are read in place
+    const auto first = reader.peek();
+    ASSERT_EQ(first.size(), 4u);
+    EXPECT_DOUBLE_EQ(first[1], 2000.0);
+    reader.consume(2);
+
+    // writing wraps around, the wrapped part is returned by the next peek
+    const std::array<double, 2> raw { 5, 6 };
+    EXPECT_EQ(writer.write_values(raw), 2u);
+    EXPECT_EQ(reader.peek().size(), 2u);
+    reader.consume(2);
+    const auto wrapped = reader.peek();
+    ASSERT_EQ(wrapped.size(), 2u);
+    EXPECT_DOUBLE_EQ(wrapped[0], 5.0);
+    EXPECT_DOUBLE_EQ(wrapped[1], 6.0);
+}
+
+TEST(shm_channel_tests, process_test)
+{
+
+    constexpr std::size_t                  count = 100000;
+    const auto                             name  = channel_name("process");
+    shm_writer<electric_current_t<double>> writer { name, 1024, electric_current_t<double> { 0, 0.001 } };
+
+    const auto child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        // the reader process checks every value and reports the result in its exit code
+        int status = 0;
+        try {
+            shm_reader<electric_current_t<double>>     reader { name };
+            std::array<electric_current_t<double>, 64> out;
+            std::size_t                                next = 0;
+            while (next < count) {
+                const auto n = reader.read(out);
+                for (std::size_t i = 0; i < n; ++i, ++next) {
+                    // writing converts the values, which can round the last bit
+                    if (std::abs(out[i].val() - static_cast<double>(next)) > 1e-9 * static_cast<double>(next) || out[i].mult() != 0.001) {
+                        status = 1;
+                    }
+                }
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        } catch (...) {
+            status = 2;
+        }
+        ::_exit(status);
+    }
+
+    std::vector<electric_current_t<double>> values;
+    for (std::size_t i = 0; i < count; ++i) {
+        values.emplace_back(static_cast<double>(i), 0.001);
+    }
+    // a full channel with a reader that already exited would block forever
+    int  status = -1;
+    bool exited = false;
+    for (std::size_t written = 0; written < count && !exited;) {
+        const auto n = writer.write(std::span { values }.subspan(written));
+        if (n == 0) {
+            exited = ::waitpid(child, &status, WNOHANG) == child;
+            std::this_thread::yield();
+        }
+        written += n;
+    }
+
+    if (!exited) {
+        ASSERT_EQ(::waitpid(child, &status, 0), child);
+    }
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
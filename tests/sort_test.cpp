@@ -0,0 +1,134 @@
+#include "test_functions.hpp"
+
+#include "unit_system/sort.hpp"
+
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+template <class base_type>
+std::vector<length_t<base_type>> mixed_lengths(std::size_t count)
+{
+    std::mt19937                           gen { 42 };
+    std::uniform_real_distribution<double> value_dist { -1000.0, 1000.0 };
+    std::uniform_int_distribution<int>     unit_dist { 0, 2 };
+    const std::array<double, 3>            multipliers { 1000.0, 1.0, 0.001 };
+
+    std::vector<length_t<base_type>> retval;
+    for (std::size_t i = 0; i < count; ++i) {
+        retval.emplace_back(value_dist(gen), multipliers[unit_dist(gen)]);
+    }
+    return retval;
+}
+
+template <class base_type>
+void expect_sorted(const std::vector<length_t<base_type>>& values)
+{
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        EXPECT_LE(values[i - 1].val() * values[i - 1].mult(), values[i].val() * values[i].mult());
+    }
+}
+
+TEST(sort_tests, radix_sort_test)
+{
+
+    auto values = mixed_lengths<double>(5000);
+    sort(values);
+    expect_sorted(values);
+}
+
+TEST(sort_tests, fallback_sort_test)
+{
+
+    auto values = mixed_lengths<long double>(5000);
+    sort(values);
+    expect_sorted(values);
+
+    auto small = mixed_lengths<double>(100);
+    sort(small);
+    expect_sorted(small);
+}
+
+TEST(sort_tests, stable_sort_test)
+{
+
+    // equal lengths in different units keep their order
+    std::vector<length_t<double>> values;
+    for (int i = 0; i < 2000; ++i) {
+        values.emplace_back(i % 2 == 0 ? 1.0 : 1000.0, i % 2 == 0 ? 1000.0 : 1.0);
+        values.emplace_back(-0.5, 1.0);
+    }
+    stable_sort(values);
+
+    for (std::size_t i = 0; i < 2000; ++i) {
+        EXPECT_EQ(values[i].val(), -0.5);
+    }
+    for (std::size_t i = 2000; i < values.size(); ++i) {
+        EXPECT_EQ(values[i].mult(), i % 2 == 0 ? 1000.0 : 1.0);
+    }
+}
+
+TEST(sort_tests, selection_test)
+{
+
+    std::vector<length> values { 3_km, 5_m, 20_mm, 1_km, 700_m, 2_m };
+
+    auto nth = values;
+    nth_element(nth, 2);
+    EXPECT_UNIT_EQ(nth[2], 5_m);
+
+    auto partial = values;
+    partial_sort(partial, 3);
+    EXPECT_UNIT_EQ(partial[0], 20_mm);
+    EXPECT_UNIT_EQ(partial[1], 2_m);
+    EXPECT_UNIT_EQ(partial[2], 5_m);
+}
+
+TEST(sort_tests, policy_test)
+{
+
+    // with a pool the keys and the gather run on the workers, the order is the same as on the calling thread
+    thread_pool           pool { 2 };
+    const parallel_policy policy { &pool, 64 };
+
+    const auto expect_same = [](const auto& a, const auto& b) {
+        ASSERT_EQ(a.size(), b.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(a[i].val(), b[i].val());
+            EXPECT_EQ(a[i].mult(), b[i].mult());
+        }
+    };
+
+    const auto doubles = mixed_lengths<double>(5000);
+    auto       radix_seq = doubles;
+    auto       radix_par = doubles;
+    stable_sort(radix_seq);
+    stable_sort(policy, radix_par);
+    expect_same(radix_seq, radix_par);
+
+    const auto long_doubles = mixed_lengths<long double>(3000);
+    auto       keyed_seq    = long_doubles;
+    auto       keyed_par    = long_doubles;
+    sort(keyed_seq);
+    sort(policy, keyed_par);
+    expect_same(keyed_seq, keyed_par);
+
+    auto partial = long_doubles;
+    partial_sort(policy, partial, 100);
+    for (std::size_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(partial[i].val(), keyed_seq[i].val());
+    }
+
+    auto nth = long_doubles;
+    nth_element(policy, nth, 1500);
+    EXPECT_EQ(nth[1500].val() * nth[1500].mult(), keyed_seq[1500].val() * keyed_seq[1500].mult());
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,129 @@
+#include "test_functions.hpp"
+
+#include "unit_system/filter.hpp"
+#include "unit_system/stream.hpp"
+
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+// a parsing stage that yields single values
+quantity_stream<length> parse(const std::vector<long double>& raw, int& resumes) {
+    for (const auto value : raw) {
+        ++resumes;
+        co_yield length { value };
+    }
+}
+
+template <class stream_t>
+std::vector<typename stream_t::unit_type> collect(stream_t&& stream) {
+    std::vector<typename stream_t::unit_type> retval;
+    for (const auto batch : stream) {
+        retval.insert(retval.end(), batch.begin(), batch.end());
+    }
+    return retval;
+}
+
+TEST(stream_tests, batch_test)
+{
+
+    const std::vector<length> lengths { 1_m, 2_km, 3_m, 4_m, 5_m };
+    std::vector<std::size_t>  sizes;
+    for (const auto batch : stream_batches(lengths, 2)) {
+        sizes.push_back(batch.size());
+    }
+    EXPECT_EQ(sizes, (std::vector<std::size_t> { 2, 2, 1 }));
+
+    // the batches refer to the range itself
+    auto stream = stream_batches(lengths, 10);
+    EXPECT_EQ((*stream.begin()).data(), lengths.data());
+}
+
+TEST(stream_tests, pipeline_test)
+{
+
+    std::vector<length> lengths;
+    for (int i = 0; i < 1000; ++i) {
+        lengths.emplace_back(i % 10, i % 2 == 0 ? 1.0 : 1000.0);
+    }
+
+    // everything is converted to km, only values above 1 km are kept and every 10 of those are summed up
+    const auto sums = collect(stream_batches(lengths, 64) | convert_to(1000.0) | where(above(1_km)) | window_sum(10));
+
+    std::vector<long double> kept;
+    for (const auto& l : lengths) {
+        if (l > 1_km) {
+            kept.push_back(l.val() * l.mult());
+        }
+    }
+    ASSERT_EQ(sums.size(), kept.size() / 10);
+    for (std::size_t w = 0; w < sums.size(); ++w) {
+        long double expected = 0;
+        for (std::size_t i = 0; i < 10; ++i) {
+            expected += kept[w * 10 + i];
+        }
+        EXPECT_NEAR(sums[w].val(), expected, 1e-9);
+        EXPECT_DOUBLE_EQ(sums[w].mult(), 1.0);
+    }
+
+    const auto converted = collect(stream_batches(lengths, 64) | convert_to(1000.0));
+    ASSERT_EQ(converted.size(), lengths.size());
+    EXPECT_DOUBLE_EQ(converted[1].mult(), 1000.0);
+    EXPECT_UNIT_EQ(converted[3], lengths[3]);
+}
+
+TEST(stream_tests, lazy_test)
+{
+
+    // nothing runs before the stream is iterated and only as much as is needed
+    const std::vector<long double> raw { 1, 2, 3, 4, 5, 6 };
+    int                            resumes = 0;
+    auto                           stream  = parse(raw, resumes) | window_sum(2);
+    EXPECT_EQ(resumes, 0);
+
+    auto it = stream.begin();
+    EXPECT_EQ(resumes, 2);
+    EXPECT_UNIT_EQ((*it)[0], 3_m);
+    ++it;
+    EXPECT_EQ(resumes, 4);
+    EXPECT_UNIT_EQ((*it)[0], 7_m);
+}
+
+quantity_stream<length> failing() {
+    co_yield 1_m;
+    throw std::runtime_error { "sensor disconnected" };
+}
+
+TEST(stream_tests, exception_test)
+{
+
+    // the exception reaches the consumer through all stages
+    EXPECT_THROW(collect(failing() | convert_to(1000.0) | where([](const length&) { return true; })), std::runtime_error);
+}
+
+template <class range_t>
+concept streamable = requires(range_t&& range) { stream_batches(std::forward<range_t>(range), 2); };
+
+TEST(stream_tests, lifetime_test)
+{
+
+    // a default constructed iterator is already at the end
+    EXPECT_TRUE(quantity_stream<length>::iterator {} == std::default_sentinel);
+
+    // a temporary vector would dangle, a temporary span refers to data that outlives it
+    static_assert(streamable<std::vector<length>&>);
+    static_assert(!streamable<std::vector<length>>);
+    static_assert(streamable<std::span<const length>>);
+
+    const std::vector<length> lengths { 1_m, 2_m, 3_m };
+    EXPECT_EQ(collect(stream_batches(std::span { lengths }, 2)).size(), 3u);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
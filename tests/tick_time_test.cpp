@@ -0,0 +1,97 @@
+#include "test_functions.hpp"
+
+#include "unit_system/tick_time.hpp"
+
+#include <chrono>
+#include <type_traits>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+using namespace std::chrono_literals;
+
+// a tick_time is exactly as large as its std::chrono::duration
+static_assert(sizeof(tick_ns) == sizeof(std::chrono::nanoseconds));
+static_assert(std::is_trivially_copyable_v<tick_ns>);
+
+// only conversions without loss are implicit
+static_assert(std::is_convertible_v<std::chrono::milliseconds, tick_ns>);
+static_assert(std::is_convertible_v<tick_ms, tick_ns>);
+static_assert(!std::is_convertible_v<std::chrono::nanoseconds, tick_ms>);
+static_assert(!std::is_convertible_v<tick_ns, tick_ms>);
+static_assert(!std::is_convertible_v<std::chrono::duration<double>, tick_ns>);
+
+// the arithmetic is constexpr
+static_assert((tick_ms { 3 } + tick_us { 500 }).count() == 3'500);
+static_assert(std::is_same_v<decltype(tick_ms { 3 } - tick_us { 500 }), tick_us>);
+static_assert((tick_ns { 3 } + 500us).count() == 500'003);
+static_assert(tick_s { 1 } > tick_ms { 999 });
+static_assert(tick_ns { 10 } * 3 == tick_ns { 30 });
+
+TEST(tick_time_tests, chrono_test)
+{
+
+    // both directions keep every tick
+    const tick_ns                  time = 1500ms;
+    const std::chrono::nanoseconds back = time;
+    EXPECT_EQ(time.count(), 1'500'000'000);
+    EXPECT_EQ(back, 1500ms);
+    EXPECT_EQ(time.chrono(), 1'500'000'000ns);
+
+    const auto now   = std::chrono::steady_clock::now();
+    const auto later = now + tick_us { 250 }.chrono();
+    EXPECT_EQ(tick_ns { later - now }, tick_us { 250 });
+
+    // lossy conversions round to the nearest tick
+    EXPECT_EQ(tick_cast<tick_ms>(1400us).count(), 1);
+    EXPECT_EQ(tick_cast<tick_ms>(tick_us { 1600 }).count(), 2);
+    EXPECT_EQ(tick_cast<tick_ns>(std::chrono::duration<double> { 0.25 }).count(), 250'000'000);
+}
+
+TEST(tick_time_tests, arithmetic_test)
+{
+
+    // adding up nanoseconds is exact
+    tick_ns ticks;
+    for (int i = 0; i < 1'000'000; ++i) {
+        ticks += tick_ns { 1 };
+    }
+    EXPECT_EQ(ticks.count(), 1'000'000);
+    EXPECT_EQ(ticks, 1ms);
+
+    tick_ns time { 2'500'000'000 };
+    time -= 500ms;
+    EXPECT_EQ(time, 2s);
+    EXPECT_EQ(-time, tick_s { -2 });
+    EXPECT_EQ(time / tick_ms { 300 }, 6);
+    EXPECT_EQ(time % tick_ms { 300 }, 200ms);
+    EXPECT_EQ(time / 3, tick_ns { 666'666'666 });
+    EXPECT_EQ(2 * time, 4s);
+    EXPECT_LT(tick_us { 999 }, 1ms);
+}
+
+TEST(tick_time_tests, unit_test)
+{
+
+    // to and from time_si
+    EXPECT_UNIT_EQ(tick_ms { 1500 }.to_unit(), 1.5_s);
+    EXPECT_UNIT_EQ(unit_cast(tick_us { 1500 }, 0.001), 1.5_ms);
+    EXPECT_DOUBLE_EQ(unit_cast(tick_us { 1500 }, 0.001).mult(), 0.001);
+    EXPECT_EQ(tick_cast<tick_ns>(1.5_us).count(), 1500);
+    EXPECT_EQ(tick_cast<tick_ms>(time_si { 2.6, 1 }).count(), 2600);
+    EXPECT_EQ(tick_cast<tick_s>(1_h), 3600s);
+
+    // the operators between time_si and the other units work with ticks
+    EXPECT_UNIT_EQ(10_mps * tick_ms { 1500 }, 15_m);
+    EXPECT_UNIT_EQ(tick_ms { 1500 } * 10_mps, 15_m);
+    EXPECT_UNIT_EQ(100_m / tick_s { 20 }, 5_mps);
+    EXPECT_UNIT_EQ(10_mps / tick_s { 2 }, acceleration(5, 1));
+    EXPECT_UNIT_EQ(2_kW * tick_s { 3600 }, 2_kWh);
+    EXPECT_UNIT_EQ(7200_J / tick_ms { 2000 }, 3600_W);
+    EXPECT_UNIT_EQ(speed_t<double>(10, 1) * tick_ms { 1500 }, length_t<double>(15, 1));
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
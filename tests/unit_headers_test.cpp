@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+// only the headers of the units that are used, not the whole unit_system.hpp
+#include "unit_system/length.hpp"
+#include "unit_system/ops/length_area.hpp"
+#include "unit_system/ops/length_length.hpp"
+
+#include <sstream>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(unit_headers_tests, single_unit_test)
+{
+
+    const auto l = 1.5_km;
+    EXPECT_DOUBLE_EQ(l.convert_copy(1.0, 0.0).val(), 1500.0);
+    EXPECT_DOUBLE_EQ(clamp(l, 2_m, 1_km).convert_copy(1.0, 0.0).val(), 1000.0);
+    EXPECT_DOUBLE_EQ(clamp(l, 2_km, 3_km).convert_copy(1.0, 0.0).val(), 2000.0);
+    EXPECT_DOUBLE_EQ(clamp(l, 2_m, 3_km).val(), 1.5);
+
+    std::stringstream stream;
+    stream << 2_m;
+    EXPECT_EQ(stream.str(), "2 metre");
+}
+
+TEST(unit_headers_tests, pairwise_operator_test)
+{
+
+    const area A = 2_m * 3_m;
+    EXPECT_DOUBLE_EQ(A.convert_copy(1.0, 0.0).val(), 6.0);
+    EXPECT_DOUBLE_EQ((A / 2_m).convert_copy(1.0, 0.0).val(), 3.0);
+    EXPECT_DOUBLE_EQ(sqrt(square(4_km)).convert_copy(1.0, 0.0).val(), 4000.0);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
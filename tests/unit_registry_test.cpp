@@ -0,0 +1,140 @@
+#include "test_functions.hpp"
+
+#include "unit_system/unit_registry.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+TEST(unit_registry_tests, builtin_test)
+{
+
+    // every literal of the library is known by its symbol
+    const auto& registry = default_unit_registry();
+    EXPECT_EQ(registry.size(), std::size(builtin_units));
+    EXPECT_UNIT_EQ(registry.make<length>(5, "km"), 5_km);
+    EXPECT_UNIT_EQ(registry.make<time_si>(3, "ms"), 3_ms);
+    EXPECT_UNIT_EQ(registry.make<energy>(2, "kWh"), 2_kWh);
+    EXPECT_UNIT_EQ(registry.make<speed>(36, "kmph"), 10_mps);
+
+    const auto celsius = registry.lookup("C");
+    ASSERT_TRUE(celsius.has_value());
+    EXPECT_EQ(celsius->dim, dimension_of<temperature>);
+    EXPECT_DOUBLE_EQ(celsius->off, 273.15);
+    EXPECT_DOUBLE_EQ(registry.make<temperature>(20, "C").off(), 273.15);
+
+    // symbols are case sensitive and have no leading underscore
+    EXPECT_TRUE(registry.contains("mA"));
+    EXPECT_TRUE(registry.contains("MA"));
+    EXPECT_FALSE(registry.contains("_mA"));
+    EXPECT_FALSE(registry.contains(""));
+
+    EXPECT_THROW((void)registry.make<length>(1, "parsec"), std::invalid_argument);
+    EXPECT_THROW((void)registry.make<length>(1, "kg"), std::invalid_argument);
+}
+
+TEST(unit_registry_tests, add_test)
+{
+
+    unit_registry registry;
+    EXPECT_FALSE(registry.contains("mph"));
+    registry.add("mph", speed { 1, 0.44704 });
+    EXPECT_TRUE(registry.contains("mph"));
+    EXPECT_UNIT_EQ(registry.make<speed>(10, "mph"), speed(4.4704, 1));
+
+    // a batch from a configuration file, known symbols may be repeated with the same definition
+    const named_unit units[] = {
+        { "F", { dimension_of<temperature>, 5.0 / 9.0, 273.15 - 32 * 5.0 / 9.0 } },
+        { "in", { dimension_of<length>, 0.0254, 0 } },
+        { "km", { dimension_of<length>, 1000.0, 0.0 } },
+    };
+    registry.add(units);
+    EXPECT_EQ(registry.size(), std::size(builtin_units) + 3);
+    EXPECT_NEAR(registry.make<temperature>(212, "F").convert_copy(1, 0).val(), 373.15, 1e-9);
+    EXPECT_UNIT_EQ(registry.make<length>(100, "in"), 2.54_m);
+
+    // redefining a symbol is rejected and leaves the registry unchanged
+    EXPECT_THROW(registry.add("km", length { 1, 1609.344 }), std::invalid_argument);
+    EXPECT_THROW(registry.add("", length { 1, 1 }), std::invalid_argument);
+    EXPECT_UNIT_EQ(registry.make<length>(1, "km"), 1_km);
+    EXPECT_EQ(registry.size(), std::size(builtin_units) + 3);
+
+    // the default registry is not changed by other registries
+    EXPECT_FALSE(default_unit_registry().contains("mph"));
+}
+
+TEST(unit_registry_tests, concurrent_test)
+{
+
+    // readers keep looking up symbols while the configuration adds units
+    unit_registry             registry;
+    std::atomic<bool>         done { false };
+    std::atomic<int>          wrong { 0 };
+    std::vector<std::jthread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                const auto km = registry.lookup("km");
+                if (!km || km->mult != 1000) {
+                    wrong.fetch_add(1);
+                }
+                if (const auto added = registry.lookup("unit_7"); added && added->mult != 7) {
+                    wrong.fetch_add(1);
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int i = 0; i < 50; ++i) {
+        registry.add("unit_" + std::to_string(i), unit_definition { dimension_of<length>, static_cast<long double>(i), 0 });
+        std::this_thread::yield();
+    }
+    done = true;
+    readers.clear();
+
+    EXPECT_EQ(wrong.load(), 0);
+    EXPECT_EQ(registry.size(), std::size(builtin_units) + 50);
+}
+
+TEST(unit_registry_tests, reload_test)
+{
+
+    // reloading the same configuration again and again keeps the table, replaced tables are freed while readers run
+    unit_registry     registry;
+    std::atomic<bool> done { false };
+    std::atomic<int>  wrong { 0 };
+    std::jthread      reader { [&] {
+        while (!done.load(std::memory_order_relaxed)) {
+            if (const auto mph = registry.lookup("mph"); mph && mph->mult != 0.44704L) {
+                wrong.fetch_add(1);
+            }
+            std::this_thread::yield();
+        }
+    } };
+
+    const named_unit units[] = {
+        { "mph", { dimension_of<speed>, 0.44704L, 0 } },
+        { "in", { dimension_of<length>, 0.0254L, 0 } },
+    };
+    for (int i = 0; i < 1000; ++i) {
+        registry.add(units);
+        registry.add("reload_" + std::to_string(i % 10), unit_definition { dimension_of<length>, 1, 0 });
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(wrong.load(), 0);
+    EXPECT_EQ(registry.size(), std::size(builtin_units) + 12);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
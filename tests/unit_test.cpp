@@ -71,6 +71,25 @@ TEST(unit_t_tests, operator_tests)
     EXPECT_UNIT_EQ(v1 * 2.0, 2.0 * v1);
 }
 
+TEST(unit_t_tests, assign_tests)
+{
+
+    const speed v1 { 1, 1000 };
+
+    // operator= copies the multiplier and offset
+    speed v2 { 5, 1 };
+    v2 = v1;
+    EXPECT_DOUBLE_EQ(v2.val(), 1.0);
+    EXPECT_DOUBLE_EQ(v2.mult(), 1000.0);
+
+    // convert_assign keeps them and converts the value
+    speed v3 { 5, 1 };
+    v3.convert_assign(v1);
+    EXPECT_DOUBLE_EQ(v3.val(), 1000.0);
+    EXPECT_DOUBLE_EQ(v3.mult(), 1.0);
+    EXPECT_UNIT_EQ(v3, v1);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# Compiles zero_overhead_kernels.cpp with optimizations and compares the instruction count of every <kernel>_unit function
+# with its <kernel>_raw counterpart in the objdump output. Fails if a unit kernel needs more instructions than the raw one.
+#
+# usage: zero_overhead.py --compiler c++ [--compiler ...] --objdump objdump --include DIR [--flag=-O3 ...] kernels.cpp
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+
+def instruction_counts(objdump, object_file):
+    disassembly = subprocess.run([objdump, '-d', '--no-show-raw-insn', object_file], capture_output=True, text=True, check=True).stdout
+    counts = {}
+    current = None
+    for line in disassembly.splitlines():
+        label = re.match(r'^[0-9a-f]+ <(\w+)>:$', line)
+        if label:
+            current = label.group(1)
+            counts[current] = 0
+        elif current and re.match(r'^\s+[0-9a-f]+:\s+\S', line):
+            # alignment padding between functions is not part of the kernel
+            if 'nop' not in line and not line.rstrip().endswith('xchg   %ax,%ax'):
+                counts[current] += 1
+    return counts
+
+
+def main():
+    parser = argparse.ArgumentParser(description='compares the object code of unit and raw kernels')
+    parser.add_argument('--compiler', action='append', required=True, help='one word of the compiler command, repeat for launchers like ccache')
+    parser.add_argument('--objdump', default='objdump')
+    parser.add_argument('--include', action='append', default=[])
+    parser.add_argument('--flag', action='append', default=[], help='compiler flags, -O2 if none are given')
+    parser.add_argument('source')
+    args = parser.parse_args()
+
+    flags = args.flag or ['-O2']
+    with tempfile.TemporaryDirectory() as directory:
+        object_file = os.path.join(directory, 'kernels.o')
+        command = [*args.compiler, '-std=c++20', *flags, *[f'-I{path}' for path in args.include], '-c', args.source, '-o', object_file]
+        result = subprocess.run(command, capture_output=True, text=True)
+        if result.returncode != 0:
+            sys.exit(f'compiling the kernels failed: {" ".join(command)}\n{result.stderr}')
+        counts = instruction_counts(args.objdump, object_file)
+
+    kernels = sorted(name[: -len('_unit')] for name in counts if name.endswith('_unit'))
+    if not kernels:
+        sys.exit('no kernels found in the object file')
+
+    failed = False
+    for kernel in kernels:
+        unit = counts[kernel + '_unit']
+        raw = counts.get(kernel + '_raw')
+        if raw is None:
+            print(f'{kernel}: no raw version')
+            failed = True
+            continue
+        status = 'ok' if unit <= raw else 'OVERHEAD'
+        print(f'{kernel:<10} unit {unit:>4} instructions, raw {raw:>4} instructions: {status}')
+        failed = failed or unit > raw
+
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == '__main__':
+    main()
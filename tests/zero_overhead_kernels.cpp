@@ -0,0 +1,58 @@
+// Reference kernels for zero_overhead.py, every kernel exists once with a unit and once with the same math on a plain struct.
+// The script compiles this file with optimizations and fails if a unit kernel has more instructions than its raw version.
+
+#include "unit_system/length.hpp"
+
+#include <cstddef>
+
+using sakurajin::unit_system::length_t;
+
+// what a length_t<double> looks like without the class around it
+struct raw_length {
+    double value;
+    double multiplier;
+    double offset;
+    double rel_error;
+};
+
+extern "C" {
+
+    // total += xs[i], every value is converted to the multiplier and offset of total
+    void sum_unit(length_t<double>& total, const length_t<double>* xs, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            total += xs[i];
+        }
+    }
+
+    void sum_raw(raw_length& total, const raw_length* xs, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            total.value += (xs[i].value * xs[i].multiplier + (xs[i].offset - total.offset)) / total.multiplier;
+        }
+    }
+
+    // xs[i] *= factor
+    void scale_unit(length_t<double>* xs, std::size_t count, double factor) {
+        for (std::size_t i = 0; i < count; ++i) {
+            xs[i] *= factor;
+        }
+    }
+
+    void scale_raw(raw_length* xs, std::size_t count, double factor) {
+        for (std::size_t i = 0; i < count; ++i) {
+            xs[i].value *= factor;
+        }
+    }
+
+    // out[i] = xs[i] converted to a new multiplier and offset
+    void convert_unit(length_t<double>* out, const length_t<double>* xs, std::size_t count, double multiplier, double offset) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = xs[i].convert_copy(multiplier, offset);
+        }
+    }
+
+    void convert_raw(raw_length* out, const raw_length* xs, std::size_t count, double multiplier, double offset) {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = {(xs[i].value * xs[i].multiplier + (xs[i].offset - offset)) / multiplier, multiplier, offset, 0.000001};
+        }
+    }
+}
@@ -0,0 +1,63 @@
+#include "test_functions.hpp"
+
+#include <type_traits>
+#include <vector>
+
+using namespace sakurajin::unit_system;
+using namespace sakurajin::unit_system::literals;
+
+// A unit is its value, multiplier, offset and relative error and nothing else.
+// These checks fail to compile if a change adds members, virtual functions or non trivial copies.
+template <class unit_t, class base_type>
+constexpr bool check_layout() {
+    static_assert(sizeof(unit_t) == 4 * sizeof(base_type));
+    static_assert(alignof(unit_t) == alignof(base_type));
+    static_assert(std::is_standard_layout_v<unit_t>);
+    static_assert(std::is_trivially_copy_constructible_v<unit_t>);
+    static_assert(std::is_trivially_destructible_v<unit_t>);
+    static_assert(std::is_nothrow_move_constructible_v<unit_t>);
+    static_assert(std::is_nothrow_move_assignable_v<unit_t>);
+    static_assert(std::is_trivially_copyable_v<unit_t>);
+    return true;
+}
+
+#ifdef USE_CPP_17
+template <class unit_t>
+constexpr bool check_unit = check_layout<unit_t, long double>();
+#else
+template <template <class> class unit_t>
+constexpr bool check_unit =
+    check_layout<unit_t<float>, float>() && check_layout<unit_t<double>, double>() && check_layout<unit_t<long double>, long double>();
+#endif
+
+#ifdef USE_CPP_17
+static_assert(check_unit<time_si> && check_unit<length> && check_unit<mass> && check_unit<temperature> && check_unit<amount>);
+static_assert(check_unit<electric_current> && check_unit<luminous_intensity> && check_unit<energy> && check_unit<power>);
+static_assert(check_unit<speed> && check_unit<acceleration> && check_unit<area> && check_unit<force> && check_unit<momentum>);
+#else
+static_assert(check_unit<time_si_t> && check_unit<length_t> && check_unit<mass_t> && check_unit<temperature_t> && check_unit<amount_t>);
+static_assert(check_unit<electric_current_t> && check_unit<luminous_intensity_t> && check_unit<energy_t> && check_unit<power_t>);
+static_assert(check_unit<speed_t> && check_unit<acceleration_t> && check_unit<area_t> && check_unit<force_t> && check_unit<momentum_t>);
+#endif
+
+TEST(zero_overhead_tests, copy_test)
+{
+
+    // copies keep all four values, including the relative error that is not part of any constructor
+    auto l       = 2_km;
+    l.rel_err()  = 0.5;
+    const auto c = l;
+    EXPECT_DOUBLE_EQ(c.val(), 2.0);
+    EXPECT_DOUBLE_EQ(c.mult(), 1000.0);
+    EXPECT_DOUBLE_EQ(c.off(), 0.0);
+    EXPECT_DOUBLE_EQ(c.rel_err(), 0.5);
+
+    const std::vector<length> lengths(3, l);
+    EXPECT_DOUBLE_EQ(lengths[2].rel_err(), 0.5);
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}